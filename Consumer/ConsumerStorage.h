@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Containers/RingQueue.h>
+#include <Containers/SegmentedQueue.h>
+
+/**
+ * @brief ThreadConsumer / CoroutineConsumer 的任务存储策略
+ *
+ * @details
+ * 存储策略决定消费者内部使用哪种无锁队列：
+ * - Queue<T>          队列类型，需提供 TryPush / TryPop(std::optional<T>&) / SizeApprox
+ * - kSingleConsumer   队列是否只允许一个消费线程
+ *
+ * 构造消费者时传入的 capacity：
+ * - RingQueueStorage  队列总容量（满时 ThreadConsumer::AddTask 等待空位，CoroutineConsumer::AddTask 返回 false）
+ * - SegmentedStorage  每个 segment 的容量（无界，AddTask 不会因满而失败）
+ *
+ * @author BUG
+ * @date 2025-12-25
+ */
+
+/**
+ * @brief 有界无锁存储（RingQueue）
+ *
+ * @tparam P 生产者并发模型
+ * @tparam C 消费者并发模型；Consumers::Single 时消费线程数被限制为 1
+ */
+template<
+    Producers P = Producers::Multi,
+    Consumers C = Consumers::Multi
+>
+struct RingQueueStorage {
+    template<typename T>
+    using Queue = RingQueue<T, P, C>;
+
+    static constexpr bool kSingleConsumer = (C == Consumers::Single);
+};
+
+/**
+ * @brief 无界分段 MPSC 存储（SegmentedQueue）
+ * @note 只允许一个消费线程
+ */
+struct SegmentedStorage {
+    template<typename T>
+    using Queue = SegmentedQueue<T>;
+
+    static constexpr bool kSingleConsumer = true;
+};
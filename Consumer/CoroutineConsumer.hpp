@@ -1,43 +1,55 @@
 #pragma once
 
 #include <coroutine>
-#include <queue>
-#include <mutex>
 #include <vector>
 #include <thread>
+#include <atomic>
+#include <optional>
+#include <utility>
 #include <functional>
-#include <condition_variable>
+#include <Executor/EventCount.h>
+#include <Consumer/ConsumerStorage.h>
 
 /**
  * @class CoroutineConsumer
  * @brief 基于协程的多协程任务消费者
  * @details
  * CoroutineConsumer 使用一个线程作为协程调度器（EventLoop）：
- * - 多个消费者协程并发消费同一个任务队列
- * - 生产者通过 AddTask() 提交任务
- * - 协程在无任务时挂起，由 EventLoop 恢复
+ * - 多个消费者协程轮流消费同一个任务队列
+ * - 生产者通过 AddTask() 提交任务，入队为一次无锁操作
+ * - EventLoop 取到任务后才恢复一个协程执行，协程执行完即挂起，从不阻塞线程
+ * - 队列为空时 EventLoop 短暂自旋后在 EventCount 上停车
+ *
+ * 所有协程都运行在 EventLoop 线程上，队列只有一个消费者，
+ * 因此默认使用无界的 SegmentedStorage；也可选择
+ * RingQueueStorage<Producers::Multi, Consumers::Single> 获得有界队列。
  *
  * @tparam T 任务类型
+ * @tparam Storage 任务存储策略（见 Consumer/ConsumerStorage.h）
  * @author BUG
  * @date 2025-12-25
  */
-template<typename T>
+template<typename T, typename Storage = SegmentedStorage>
 class CoroutineConsumer {
 public:
     /// 任务处理回调类型
     using Callback = std::function<void(T)>;
 
+    /// 内部任务队列类型
+    using Queue = typename Storage::template Queue<T>;
+
     /**
      * @brief 构造协程消费者
      * @details 仅初始化内部状态，不启动线程或协程
      *
      * @param func 用户任务处理回调
      * @param coroutineCount 消费者协程数量
+     * @param capacity 队列容量（分段存储时为每段容量）
      * @author BUG
      * @date 2025-12-25
      */
-    CoroutineConsumer(Callback func, int coroutineCount = 1)
-        : _callback(std::move(func)), _running(false), _coroutineCount(coroutineCount)
+    CoroutineConsumer(Callback func, int coroutineCount = 1, size_t capacity = 1024)
+        : _callback(std::move(func)), _queue(capacity), _running(false), _coroutineCount(coroutineCount)
     {}
 
     /**
@@ -62,8 +74,7 @@ public:
      * @date 2025-12-25
      */
     void Start() {
-        if (_running) return;
-        _running = true;
+        if (_running.exchange(true)) return;
         for (int i = 0; i < _coroutineCount; i++) {
             _coroutines.push_back(ConsumeCoroutine());
         }
@@ -74,60 +85,67 @@ public:
      * @brief 停止协程消费者系统
      * @details
      * - 设置运行状态为 false
-     * - 唤醒 EventLoop
-     * - 等待调度线程退出
+     * - 唤醒 EventLoop，等待其处理完剩余任务后退出
+     * - 结束并销毁所有消费者协程
      * @thread_safety 线程安全
      * @author BUG
      * @date 2025-12-25
      */
     void Stop() {
-        if (!_running) return;
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _running = false;
-        }
-        _cv.notify_all();
+        if (!_running.exchange(false)) return;
+        _parking.NotifyAll();
         if (_worker.joinable())
             _worker.join();
+
+        // EventLoop 已退出：以空任务恢复每个协程，使其走到 final_suspend 后销毁
+        _current.reset();
+        for (auto& c : _coroutines) {
+            if (c.h && !c.h.done())
+                c.h.resume();
+            if (c.h)
+                c.h.destroy();
+        }
+        _coroutines.clear();
     }
 
     /**
      * @brief 添加任务到队列
      * @details
-     * 将任务加入内部队列，通知 EventLoop 恢复等待协程
+     * 将任务加入内部无锁队列，唤醒停车中的 EventLoop
      *
      * @param task 要处理的任务
+     * @return false 表示未运行或队列已满（有界存储），任务未入队
      * @thread_safety 线程安全
      * @author BUG
      * @date 2025-12-25
      */
-    void AddTask(T task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            if (!_running) return;
-            _queue.push(std::move(task));
-        }
-        _cv.notify_one();
+    bool AddTask(T task) {
+        if (!_running.load(std::memory_order_acquire)) return false;
+
+        RingQueueResult r;
+        while ((r = _queue.TryPush(std::move(task))) == RingQueueResult::Busy)
+            CpuRelax();
+        if (r != RingQueueResult::Ok) return false;
+
+        _parking.NotifyOne();
+        return true;
     }
 
     /**
      * @brief 获取当前任务队列大小
-     * @return 队列中未处理任务数量
+     * @return 队列中未处理任务数量（近似值）
      * @thread_safety 线程安全
      * @author BUG
      * @date 2025-12-25
      */
     size_t size() const {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _queue.size();
+        return _queue.SizeApprox();
     }
 
 private:
     /**
-     * @brief 消费者协程主函数
-     * @details
-     * 循环等待任务，co_await 挂起协程，无任务时不会阻塞线程
-     * @return ConsumerTask 协程对象
+     * @brief 消费者协程对象
+     * @details 持有协程句柄，由 Stop() 负责销毁
      * @author BUG
      * @date 2025-12-25
      */
@@ -148,60 +166,76 @@ private:
 
     /**
      * @brief 协程执行函数
-     * @details 每个协程循环取任务执行回调
+     * @details
+     * 每次被恢复时执行 EventLoop 交付的任务 _current，执行完即 co_await 挂起；
+     * 以空 _current 恢复即退出
      * @return ConsumerTask 协程对象
      * @author BUG
      * @date 2025-12-25
      */
     ConsumerTask ConsumeCoroutine() {
-        while (true) {
-            T task;
-            {
-                std::unique_lock<std::mutex> lock(_mutex);
-                _cv.wait(lock, [&] { return !_queue.empty() || !_running; });
-                if (!_running && _queue.empty()) co_return;
-                task = std::move(_queue.front());
-                _queue.pop();
-            }
-            _callback(std::move(task));
+        while (_current) {
+            _callback(std::move(*_current));
+            _current.reset();
             co_await std::suspend_always{};
         }
     }
 
     /**
      * @brief 协程调度线程
-     * @details 唤醒等待中的协程，保持协程调度系统运行
+     * @details
+     * - 取到任务后轮转恢复一个消费者协程执行
+     * - 队列为空时自旋 kSpinCount 次，再在 EventCount 上停车
+     * - Stop() 后处理完队列中剩余任务再退出
      * @author BUG
      * @date 2025-12-25
      */
     void EventLoop() {
+        size_t next = 0;
+        size_t spin = 0;
+
         while (true) {
-            std::coroutine_handle<> waiter;
-            {
-                std::unique_lock<std::mutex> lock(_mutex);
-                if (!_running && _queue.empty() && _waiters.empty()) break;
-                _cv.wait(lock, [&]{ return !_queue.empty() || !_running; });
-                if (_waiters.empty()) continue;
-                waiter = _waiters.front();
-                _waiters.pop();
+            RingQueueResult r = _queue.TryPop(_current);
+            if (r == RingQueueResult::Ok) {
+                spin = 0;
+                if (_coroutines.empty()) {
+                    _callback(std::move(*_current));
+                    _current.reset();
+                    continue;
+                }
+                _coroutines[next].h.resume();
+                next = (next + 1) % _coroutines.size();
+                continue;
             }
-            if (waiter) waiter.resume();
-        }
 
-        while (!_waiters.empty()) {
-            auto h = _waiters.front();
-            _waiters.pop();
-            h.resume();
+            if (!_running.load(std::memory_order_acquire)) {
+                if (r == RingQueueResult::Empty) break;
+                continue;
+            }
+
+            if (r == RingQueueResult::Busy || ++spin < kSpinCount) {
+                CpuRelax();
+                continue;
+            }
+
+            spin = 0;
+            auto key = _parking.PrepareWait();
+            if (_queue.SizeApprox() > 0 || !_running.load(std::memory_order_acquire)) {
+                _parking.CancelWait();
+                continue;
+            }
+            _parking.Wait(key);
         }
     }
 
 private:
+    static constexpr size_t kSpinCount = 64; ///< 停车前的自旋次数
+
     Callback _callback;                         ///< 用户任务处理回调
-    std::queue<T> _queue;                       ///< 任务队列
-    std::queue<std::coroutine_handle<>> _waiters; ///< 等待中的协程
-    mutable std::mutex _mutex;                  ///< 队列互斥锁
-    std::condition_variable _cv;                ///< 条件变量用于唤醒协程
-    bool _running;                              ///< 是否处于运行状态
+    Queue _queue;                               ///< 任务队列（无锁）
+    std::optional<T> _current;                  ///< EventLoop 交付给协程的任务（仅调度线程访问）
+    EventCount _parking;                        ///< EventLoop 停车/唤醒
+    std::atomic<bool> _running;                 ///< 是否处于运行状态
     int _coroutineCount;                        ///< 协程数量
     std::vector<ConsumerTask> _coroutines;      ///< 协程对象集合
     std::thread _worker;                        ///< 调度线程
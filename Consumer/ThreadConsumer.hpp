@@ -1,45 +1,66 @@
 #pragma once
 
-#include <queue>
-#include <mutex>
 #include <vector>
 #include <thread>
+#include <atomic>
+#include <optional>
+#include <utility>
 #include <functional>
-#include <condition_variable>
+#include <Executor/EventCount.h>
+#include <Executor/Backpressure.h>
+#include <Executor/ExecutorMetrics.h>
+#include <Executor/ThreadConfig.h>
+#include <Consumer/ConsumerStorage.h>
 
 /**
  * @class ThreadConsumer
  * @brief 基于线程的多线程任务消费者
  * @details
  * ThreadConsumer 使用固定数量的工作线程消费任务队列：
- * - 生产者通过 AddTask() 提交任务
- * - 消费者线程阻塞等待任务
+ * - 生产者通过 AddTask() 提交任务，入队为一次无锁操作，不持有任何互斥锁
+ * - 有界队列已满时 AddTask 等待空位（自旋 → yield → 在 EventCount 上停车，见 Executor/Backpressure.h），
+ *   任务不会因队列满而丢失；只有未运行时 AddTask 才返回 false
+ * - 消费者线程无任务时先短暂自旋，再在 EventCount 上停车，不消耗 CPU
  * - Stop() 可选择等待队列任务处理完成
  *
+ * 任务存储由 Storage 策略决定（见 Consumer/ConsumerStorage.h）：
+ * - RingQueueStorage<>  有界 MPMC，满时 AddTask 等待空位
+ * - SegmentedStorage    无界 MPSC，线程数被限制为 1
+ *
  * 适用于 CPU 密集或不支持协程的任务模型。
  *
  * @tparam T 任务类型
+ * @tparam Storage 任务存储策略
  * @author BUG
  * @date 2025-12-25
  */
-template<typename T>
+template<typename T, typename Storage = RingQueueStorage<>>
 class ThreadConsumer{
 public:
     /// 任务处理回调类型
     using Callback = std::function<void(T)>;
 
+    /// 内部任务队列类型
+    using Queue = typename Storage::template Queue<T>;
+
     /**
      * @brief 构造线程消费者
      * @details 初始化内部状态，但不创建线程
      *
      * @param func 用户提供的任务处理回调函数
-     * @param threadCount 工作线程数量
+     * @param threadCount 工作线程数量（单消费者存储时被限制为 1）
+     * @param capacity 队列容量（分段存储时为每段容量）
      * @author BUG
      * @date 2025-12-25
      */
-    ThreadConsumer(Callback func, int threadCount = 1)
-        : _callback(std::move(func)), _running(false)
+    ThreadConsumer(Callback func, int threadCount = 1, size_t capacity = 1024)
+        : _running(false), _discard(false), _callback(std::move(func)), _task_queue(capacity)
+        , _metrics(threadCount < 1 ? 1 : static_cast<size_t>(threadCount))
     {
+        if (threadCount < 1) threadCount = 1;
+        if constexpr (Storage::kSingleConsumer) {
+            threadCount = 1;
+        }
         _threads.resize(threadCount);
     }
 
@@ -54,6 +75,19 @@ public:
         Stop(true);
     }
 
+    /**
+     * @brief 设置工作线程的命名 / CPU 绑定 / NUMA 内存策略（见 ThreadConfig）
+     * @details 每个工作线程进入 ThreadFunc 主循环前以自己的编号调用 ApplyThreadConfig
+     *
+     * @param config 线程配置
+     * @thread_safety 非线程安全，只能在 Start() 之前调用
+     * @author BUG
+     * @date 2025-12-30
+     */
+    void SetThreadConfig(ThreadConfig config){
+        _threadConfig = std::move(config);
+    }
+
     /**
      * @brief 启动工作线程
      * @details 创建 threadCount 个线程执行 ThreadFunc
@@ -64,18 +98,21 @@ public:
      * @date 2025-12-25
      */
     void Start(){
-        if(_running) return;
+        if(_running.exchange(true)) return;
 
-        _running = true;
-        for(auto& t : _threads)
-            t = std::thread(&ThreadConsumer::ThreadFunc, this);
+        _discard.store(false, std::memory_order_relaxed);
+        for(size_t i = 0; i < _threads.size(); ++i)
+            _threads[i] = std::thread(&ThreadConsumer::ThreadFunc, this, i);
     }
 
     /**
      * @brief 停止线程消费者
      * @details
-     * 设置运行状态为 false，并唤醒所有线程。
-     * 可选择等待任务队列处理完后再退出。
+     * 设置运行状态为 false，并唤醒所有停车的线程与等待空位的生产者。
+     * 可选择等待队列任务处理完后再退出。
+     * 已通过运行检查的 AddTask 完成入队（或因等待空位而放弃）后才 join（见 InFlightGuard），
+     * 因此不会有任务在 Stop() 返回后滞留在队列中；
+     * 在线程退出后才入队的任务：wait_all_tasks 为 true 时在调用线程上执行，否则丢弃。
      *
      * @param wait_all_tasks true 等待队列任务完成，false 清空队列立即退出
      * @thread_safety 线程安全
@@ -83,111 +120,223 @@ public:
      * @date 2025-12-25
      */
     void Stop(bool wait_all_tasks = false){
-        {
-            std::lock_guard<std::mutex> lock(_queue_mutex);
-            _running = false;
-        }
+        if(!_running.exchange(false, std::memory_order_seq_cst)) return;
 
-        _cv.notify_all();
-
-        if(wait_all_tasks){
-            for(auto& t : _threads)
-                if(t.joinable())
-                    t.join();
-        } else {
-            {
-                std::lock_guard<std::mutex> lock(_queue_mutex);
-                std::queue<T> empty;
-                std::swap(_task_queue, empty);
-            }
-            for(auto& t : _threads)
-                if(t.joinable())
-                    t.join();
+        _discard.store(!wait_all_tasks, std::memory_order_release);
+        _parking.NotifyAll();
+        _space.NotifyAll();
+        while(_inFlight.load(std::memory_order_seq_cst) != 0)
+            std::this_thread::yield();
+
+        for(auto& t : _threads)
+            if(t.joinable())
+                t.join();
+
+        std::optional<T> task;
+        while(_task_queue.TryPop(task) != RingQueueResult::Empty){
+            if(task && wait_all_tasks)
+                _callback(std::move(*task));
+            task.reset();
         }
     }
 
     /**
      * @brief 添加任务（拷贝）
-     * @details 将任务拷贝入队列，唤醒一个等待线程
+     * @details
+     * 将任务拷贝入队列，唤醒一个停车的线程。
+     * 队列已满时等待空位；在本消费者的工作线程内调用且队列已满时，
+     * 直接在当前线程执行回调（caller-runs），避免所有工作线程都在等待空位而自锁
      *
      * @param task 要处理的任务
+     * @return false 表示未运行（未 Start() 或已 Stop()），任务未入队
      * @thread_safety 线程安全
      * @author BUG
      * @date 2025-12-25
      */
-    void AddTask(const T& task){
-        {
-            std::lock_guard<std::mutex> lock(_queue_mutex);
-            if(!_running) return;
-            _task_queue.push(task);
+    [[nodiscard]] bool AddTask(const T& task){
+        if constexpr (kMetricsEnabled && HasEnqueueTime<T>::value) {
+            T copy(task);
+            return AddTask(std::move(copy));
         }
-        _cv.notify_one();
+        return Enqueue(task);
     }
 
     /**
      * @brief 添加任务（移动）
-     * @details 将任务移动入队列，唤醒一个等待线程
+     * @details 语义同 AddTask(const T&)
      *
-     * @param task 要处理的任务
+     * @param task 要处理的任务，入队失败时保持原样
+     * @return false 表示未运行（未 Start() 或已 Stop()），任务未入队
      * @thread_safety 线程安全
      * @author BUG
      * @date 2025-12-25
      */
-    void AddTask(T&& task){
-        {
-            std::lock_guard<std::mutex> lock(_queue_mutex);
-            if(!_running) return;
-            _task_queue.push(std::move(task));
+    [[nodiscard]] bool AddTask(T&& task){
+        MetricsStampEnqueue(task);
+        return Enqueue(std::move(task));
+    }
+
+    /**
+     * @brief 尝试添加任务（不等待空位）
+     * @details 仅在并发竞争（Busy）时重试，队列满时立即返回 false；用于宁可丢弃也不阻塞生产者的场景
+     *
+     * @param task 要处理的任务（按值传入，入队失败时随之析构）
+     * @return false 表示未运行或队列已满，任务未入队
+     * @thread_safety 线程安全
+     * @author BUG
+     * @date 2025-12-31
+     */
+    [[nodiscard]] bool TryAddTask(T task){
+        InFlightGuard guard(_inFlight);
+        if(!_running.load(std::memory_order_seq_cst)) return false;
+
+        MetricsStampEnqueue(task);
+        RingQueueResult r;
+        while((r = _task_queue.TryPush(std::move(task))) == RingQueueResult::Busy){
+            _metrics.AddRejected(r);
+            CpuRelax();
+        }
+        if(r != RingQueueResult::Ok){
+            _metrics.AddRejected(r);
+            return false;
         }
-        _cv.notify_one();
+
+        _metrics.AddSubmitted();
+        _parking.NotifyOne();
+        return true;
     }
 
     /**
      * @brief 获取当前任务队列大小
-     * @return 队列中未处理任务数量
+     * @return 队列中未处理任务数量（近似值）
      * @thread_safety 线程安全
      * @author BUG
      * @date 2025-12-25
      */
     size_t size() const {
-        std::lock_guard<std::mutex> lock(_queue_mutex);
-        return _task_queue.size();
+        return _task_queue.SizeApprox();
+    }
+
+    /**
+     * @brief 获取运行指标快照
+     * @details
+     * - 仅在 -DEXECUTOR_METRICS 时计数，否则只有 queueDepth 有效
+     * - rejectedBusy 为 AddTask 内部因竞争重试的次数，rejectedFull 为等待空位期间的重试次数
+     * - 等待时间直方图只统计带入队时间戳的任务（如 TimedTask<T>），AddTask 时打戳
+     * - Stop(true) 在调用线程上补执行的任务不计入
+     * @thread_safety 线程安全，不影响热路径
+     * @author BUG
+     * @date 2025-12-29
+     */
+    ExecutorStats Metrics() const {
+        return _metrics.Snapshot(_task_queue.SizeApprox());
     }
 
 private:
+    /**
+     * @brief 入队并唤醒
+     * @details
+     * - 运行检查与入队之间登记在 _inFlight 中，Stop() 等待其归零后才 join
+     * - 竞争（Busy）立即重试；队列满时按 SubmitWithBackpressure 等待空位，
+     *   工作线程内调用则直接执行回调
+     * @author BUG
+     * @date 2025-12-25
+     */
+    template<typename U>
+    bool Enqueue(U&& task){
+        InFlightGuard guard(_inFlight);
+        if(!_running.load(std::memory_order_seq_cst)) return false;
+
+        auto tryOnce = [&]{
+            RingQueueResult r = _task_queue.TryPush(std::forward<U>(task));
+            if(r != RingQueueResult::Ok) _metrics.AddRejected(r);
+            return r;
+        };
+
+        if(_tlsOwner == this){
+            RingQueueResult r;
+            while((r = tryOnce()) == RingQueueResult::Busy)
+                CpuRelax();
+            if(r != RingQueueResult::Ok){
+                _callback(std::forward<U>(task));
+                return true;
+            }
+        }else if(!SubmitWithBackpressure(_space, tryOnce,
+                     [&]{ return _running.load(std::memory_order_acquire); })){
+            return false;
+        }
+
+        _metrics.AddSubmitted();
+        _parking.NotifyOne();
+        return true;
+    }
+
     /**
      * @brief 工作线程主函数
      * @details
-     * - 等待任务或停止信号
      * - 取出任务执行回调
-     * - Stop() 后在队列空时退出
+     * - 队列为空时自旋 kSpinCount 次后在 EventCount 上停车
+     * - Stop() 后在队列空时退出（wait_all_tasks 为 false 时立即退出）
+     *
+     * @param index 工作线程编号（对应指标分片）
      * @author BUG
      * @date 2025-12-25
      */
-    void ThreadFunc(){
-        while(true){
-            T task;
+    void ThreadFunc(size_t index){
+        ApplyThreadConfig(_threadConfig, index);
+        _tlsOwner = this;
+        WorkerMetrics& metrics = _metrics.Worker(index);
+        std::optional<T> task;
+        size_t spin = 0;
 
-            {
-                std::unique_lock<std::mutex> lock(_queue_mutex);
-                _cv.wait(lock, [&]{ return !_task_queue.empty() || !_running; });
+        while(true){
+            RingQueueResult r = _task_queue.TryPop(task);
+            if(r == RingQueueResult::Ok){
+                _space.NotifyOne();
+                uint64_t start = metrics.Now();
+                metrics.BeginTask(*task, start);
+                _callback(std::move(*task));
+                metrics.EndTask(start);
+                task.reset();
+                spin = 0;
+                continue;
+            }
 
-                if(!_running && _task_queue.empty())
+            if(!_running.load(std::memory_order_acquire)){
+                if(_discard.load(std::memory_order_acquire) || r == RingQueueResult::Empty)
                     return;
+                continue;
+            }
 
-                task = std::move(_task_queue.front());
-                _task_queue.pop();
+            if(r == RingQueueResult::Busy || ++spin < kSpinCount){
+                CpuRelax();
+                continue;
             }
 
-            _callback(std::move(task));
+            spin = 0;
+            auto key = _parking.PrepareWait();
+            if(_task_queue.SizeApprox() > 0 || !_running.load(std::memory_order_acquire)){
+                _parking.CancelWait();
+                continue;
+            }
+            metrics.AddPark();
+            _parking.Wait(key);
         }
     }
 
 private:
-    bool _running;                     ///< 是否处于运行状态
+    static constexpr size_t kSpinCount = 64; ///< 停车前的自旋次数
+
+    static inline thread_local ThreadConsumer* _tlsOwner = nullptr; ///< 当前线程所属的消费者（工作线程）
+
+    std::atomic<bool> _running;        ///< 是否处于运行状态
+    std::atomic<bool> _discard;        ///< Stop 时是否丢弃剩余任务
     std::vector<std::thread> _threads; ///< 工作线程集合
-    std::condition_variable _cv;       ///< 条件变量，用于唤醒线程
+    ThreadConfig _threadConfig;        ///< 工作线程放置与命名
     Callback _callback;                ///< 用户任务处理回调
-    std::queue<T> _task_queue;         ///< 等待处理的任务队列
-    mutable std::mutex _queue_mutex;   ///< 保护任务队列的互斥锁
+    Queue _task_queue;                 ///< 等待处理的任务队列（无锁）
+    EventCount _parking;               ///< 空闲线程停车/唤醒
+    EventCount _space;                 ///< 等待队列空位的生产者停车/唤醒
+    alignas(kCacheLineSize) std::atomic<size_t> _inFlight{0}; ///< 已通过运行检查、尚未完成入队的 AddTask 数
+    ExecutorMetrics _metrics;          ///< 运行指标（EXECUTOR_METRICS 关闭时为空实现）
 };
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+// cache line 大小：用于隔离 head / tail 等高频竞争的原子变量
+#ifdef __cpp_lib_hardware_interference_size
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr size_t kCacheLineSize = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr size_t kCacheLineSize = 64;
+#endif
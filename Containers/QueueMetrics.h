@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <Containers/CacheLine.h>
+
+// 编译期指标开关：-DEXECUTOR_METRICS 打开 RingQueue / Executor / Consumer 的计数与直方图
+// 关闭（默认）时所有记录函数为空的 inline 函数，热路径不产生任何指令
+#ifndef EXECUTOR_METRICS
+    #define EXECUTOR_METRICS 0
+#endif
+
+inline constexpr bool kMetricsEnabled = EXECUTOR_METRICS != 0;
+
+/// 多写者计数器的分片数：不同线程落在不同 cache line 上，避免计数本身成为竞争点
+inline constexpr size_t kMetricsStripes = 8;
+
+/**
+ * @brief 当前线程使用的计数分片编号
+ * @details 线程第一次调用时轮转分配，此后固定不变
+ */
+inline size_t MetricsStripeIndex() {
+    static std::atomic<size_t> next{0};
+    thread_local size_t index = next.fetch_add(1, std::memory_order_relaxed) % kMetricsStripes;
+    return index;
+}
+
+/**
+ * @brief RingQueue 失败路径计数快照
+ *
+ * @details
+ * - pushFull  TryPush / TryEmplace 返回 Full、TryPushBulk 因无空闲 slot 返回 0 的次数
+ * - pushBusy  推入时与其他生产者竞争失败（Busy / CAS 失败）的次数
+ * - popBusy   弹出时与其他消费者竞争失败、或生产者已占位未发布的次数
+ *
+ * 只统计失败路径，成功的 push / pop 不做任何额外工作；
+ * 成功次数由上层（Executor 的 submitted / executed）统计。
+ */
+struct RingQueueStats {
+    size_t pushFull = 0;
+    size_t pushBusy = 0;
+    size_t popBusy = 0;
+};
+
+/**
+ * @brief RingQueue 失败路径计数器（EXECUTOR_METRICS 打开时）
+ *
+ * @details
+ * 任意线程都可能写入，按 MetricsStripeIndex() 分片后 fetch_add（relaxed），
+ * 每个分片独占 cache line；Snapshot() 时才跨分片求和。
+ */
+class RingQueueCounters {
+public:
+    void AddPushFull() { Stripe().pushFull.fetch_add(1, std::memory_order_relaxed); }
+    void AddPushBusy() { Stripe().pushBusy.fetch_add(1, std::memory_order_relaxed); }
+    void AddPopBusy() { Stripe().popBusy.fetch_add(1, std::memory_order_relaxed); }
+
+    RingQueueStats Snapshot() const {
+        RingQueueStats stats;
+        for (const auto& s : _stripes) {
+            stats.pushFull += s.pushFull.load(std::memory_order_relaxed);
+            stats.pushBusy += s.pushBusy.load(std::memory_order_relaxed);
+            stats.popBusy += s.popBusy.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+private:
+    struct alignas(kCacheLineSize) Counters {
+        std::atomic<size_t> pushFull{0};
+        std::atomic<size_t> pushBusy{0};
+        std::atomic<size_t> popBusy{0};
+    };
+
+    Counters& Stripe() { return _stripes[MetricsStripeIndex()]; }
+
+    Counters _stripes[kMetricsStripes];
+};
+
+/**
+ * @brief 指标关闭时的空实现
+ */
+struct NullRingQueueCounters {
+    void AddPushFull() {}
+    void AddPushBusy() {}
+    void AddPopBusy() {}
+    RingQueueStats Snapshot() const { return {}; }
+};
+
+using RingQueueMetrics = std::conditional_t<kMetricsEnabled, RingQueueCounters, NullRingQueueCounters>;
@@ -1,7 +1,16 @@
+#pragma once
+
 #include <atomic>
 #include <vector>
+#include <new>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <optional>
+#include <utility>
+#include <iterator>
+#include <Containers/CacheLine.h>
+#include <Containers/QueueMetrics.h>
 
 enum class RingQueueResult {
     Ok = 0,
@@ -10,29 +19,73 @@ enum class RingQueueResult {
     Busy,
 };
 
+/// 生产者并发模型
+enum class Producers {
+    Single, ///< 仅一个线程/协程调用 TryPush
+    Multi,  ///< 任意线程/协程可并发调用 TryPush
+};
+
+/// 消费者并发模型
+enum class Consumers {
+    Single, ///< 仅一个线程/协程调用 TryPop
+    Multi,  ///< 任意线程/协程可并发调用 TryPop
+};
+
+/// 节点内存布局
+enum class NodeLayout {
+    Packed, ///< 节点紧密排列，内存占用小
+    Padded, ///< 每个节点独占一条 cache line，避免相邻 slot 伪共享
+};
+
 /**
  * @class RingQueue
  * @brief 一个协程和线程都安全的环形队列
  * @details 该类提供了一个线程安全和协程安全的环形队列实现，适用于多线程或多协程环境下的数据交换。
+ *
+ * 并发策略（模板参数）：
+ * - P = Producers::Multi   多生产者通过 CAS 竞争 _tail
+ * - P = Producers::Single  单生产者直接 store-release 推进 _tail，无 CAS
+ * - C = Consumers::Multi   多消费者通过 CAS 竞争 _head
+ * - C = Consumers::Single  单消费者直接 store-release 推进 _head，无 CAS
+ *
+ * 内存布局：
+ * - _head / _tail 各自独占一条 cache line，生产者与消费者互不干扰
+ * - 容量向上取整为 2 的幂，slot 索引使用位掩码而非取模
+ * - L = NodeLayout::Padded 时每个节点按 cache line 对齐
+ *
+ * @tparam T 元素类型
+ * @tparam P 生产者并发模型
+ * @tparam C 消费者并发模型
+ * @tparam L 节点内存布局
  * @author BUG
  * @date 2025-12-22
  */
 
-template<typename T>
+template<
+    typename T,
+    Producers P = Producers::Multi,
+    Consumers C = Consumers::Multi,
+    NodeLayout L = NodeLayout::Packed
+>
 class RingQueue {
 public:
+    static constexpr Producers kProducers = P;
+    static constexpr Consumers kConsumers = C;
+    static constexpr NodeLayout kLayout = L;
+
     /**
      * @brief 构造函数
      * @details 初始话化一个指定容量的环形队列。
-     * @param capacity 队列中可容纳的最大元素数量。
+     * @param capacity 队列中可容纳的最大元素数量，会向上取整为 2 的幂。
      * @return 无
      * @author BUG
      * @date 2025-12-22
      */
     explicit RingQueue(size_t capacity)
-        : nodes_(capacity)
+        : _mask(RoundUpPowerOfTwo(capacity) - 1)
+        , nodes_(_mask + 1)
     {
-        for (size_t i = 0; i < capacity; ++i) {
+        for (size_t i = 0; i < nodes_.size(); ++i) {
             nodes_[i].sequence.store(i, std::memory_order_relaxed);
         }
         _head.store(0, std::memory_order_relaxed);
@@ -41,20 +94,33 @@ public:
 
     /**
      * @brief 析构函数
-     * @details 释放环形队列所占用的资源。析构前必须保证没有并发访问
+     * @details 释放环形队列所占用的资源，并析构队列中尚未弹出的元素。析构前必须保证没有并发访问
      * @return 无
      * @author BUG
      * @date 2025-12-22
      */
-    ~RingQueue() = default;
+    ~RingQueue() {
+        size_t head = _head.load(std::memory_order_relaxed);
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            Node& node = nodes_[head & _mask];
+            if (node.sequence.load(std::memory_order_relaxed) == head + 1) {
+                node.Ptr()->~T();
+            }
+        }
+    }
+
+    RingQueue(const RingQueue&) = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
 
     /**
-     * @brief 尝试将元素推入队列（非阻塞）
+     * @brief 尝试将元素拷贝推入队列（非阻塞）
      *
      * @details
      * - 该函数不会阻塞线程或协程
      * - 若当前发生并发竞争或 slot 尚未就绪，会立即返回 Busy
      * - 调用者可选择重试、让出执行权或结合外部同步机制
+     * - Producers::Single 时不执行 CAS，也不会返回 Busy
      *
      * @param item 要推入的元素
      *
@@ -68,34 +134,79 @@ public:
      * @date 2025-12-22
      */
     inline RingQueueResult TryPush(const T& item) {
-        size_t tail = _tail.load(std::memory_order_relaxed);
-        size_t head = _head.load(std::memory_order_acquire);
+        return TryEmplace(item);
+    }
 
-        // 快速满判断（hint）
-        if (tail - head >= nodes_.size()) {
-            return RingQueueResult::Full;
-        }
+    /**
+     * @brief 尝试将元素移动推入队列（非阻塞）
+     *
+     * @details
+     * - 语义同 TryPush(const T&)
+     * - 仅在推入成功时才会移动 item；返回 Full / Busy 时 item 保持不变，可直接重试
+     *
+     * @param item 要推入的元素
+     *
+     * @return 同 TryPush(const T&)
+     *
+     * @thread_safety 线程安全 / 协程安全（非阻塞）
+     * @author BUG
+     * @date 2025-12-22
+     */
+    inline RingQueueResult TryPush(T&& item) {
+        return TryEmplace(std::move(item));
+    }
 
-        size_t index = tail % nodes_.size();
-        Node& node = nodes_[index];
+    /**
+     * @brief 尝试在队列 slot 中原地构造元素（非阻塞）
+     *
+     * @details
+     * - 抢占 slot 成功后才以 args 构造元素，失败时不会构造也不会消耗 args
+     * - 元素直接构造在 slot 的未初始化存储中，不要求 T 可默认构造
+     *
+     * @param args 传递给 T 构造函数的参数
+     *
+     * @return 同 TryPush(const T&)
+     *
+     * @note
+     * T 的构造不应抛出异常：slot 已被占用，异常会使该 slot 永远无法发布
+     *
+     * @thread_safety 线程安全 / 协程安全（非阻塞）
+     * @author BUG
+     * @date 2025-12-22
+     */
+    template<typename... Args>
+    inline RingQueueResult TryEmplace(Args&&... args) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        Node& node = nodes_[tail & _mask];
 
         size_t seq = node.sequence.load(std::memory_order_acquire);
         intptr_t diff =
             static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail);
 
         if (diff != 0) {
-            if (diff < 0) return RingQueueResult::Full;
+            // slot 仍被上一轮占用：队列已满
+            if (diff < 0) {
+                _metrics.AddPushFull();
+                return RingQueueResult::Full;
+            }
+            // 其他生产者已抢先推进 _tail
+            _metrics.AddPushBusy();
             return RingQueueResult::Busy;
         }
 
-        if (!_tail.compare_exchange_strong(
-                tail, tail + 1,
-                std::memory_order_acq_rel,
-                std::memory_order_relaxed)) {
-            return RingQueueResult::Busy;
+        if constexpr (P == Producers::Multi) {
+            if (!_tail.compare_exchange_strong(
+                    tail, tail + 1,
+                    std::memory_order_relaxed,
+                    std::memory_order_relaxed)) {
+                _metrics.AddPushBusy();
+                return RingQueueResult::Busy;
+            }
+        } else {
+            _tail.store(tail + 1, std::memory_order_release);
         }
 
-        node.data = item;
+        ::new (static_cast<void*>(node.storage)) T(std::forward<Args>(args)...);
         node.sequence.store(tail + 1, std::memory_order_release);
         return RingQueueResult::Ok;
     }
@@ -107,6 +218,8 @@ public:
      * - 该函数不会阻塞线程或协程
      * - 若当前发生并发竞争或 slot 尚未准备好，会立即返回 Busy
      * - 若队列为空，返回 Empty
+     * - Consumers::Single 时不执行 CAS
+     * - 元素被移动赋值到 item，随后 slot 中的对象被析构
      *
      * @param item 用于接收弹出元素的引用
      *
@@ -119,38 +232,143 @@ public:
      * @date 2025-12-22
      */
     inline RingQueueResult TryPop(T& item) {
-        size_t head = _head.load(std::memory_order_relaxed);
-        size_t tail = _tail.load(std::memory_order_acquire);
+        return TryConsume([&](T&& value) { item = std::move(value); });
+    }
 
-        if (head == tail) {
-            return RingQueueResult::Empty;
-        }
+    /**
+     * @brief 尝试从队列弹出一个元素到 optional（非阻塞）
+     *
+     * @details
+     * - 语义同 TryPop(T&)
+     * - 以移动构造的方式 emplace 到 item，适用于不可默认构造的 T
+     *
+     * @param item 用于接收弹出元素的 optional，成功时被覆盖
+     *
+     * @return 同 TryPop(T&)
+     *
+     * @author BUG
+     * @date 2025-12-22
+     */
+    inline RingQueueResult TryPop(std::optional<T>& item) {
+        return TryConsume([&](T&& value) { item.emplace(std::move(value)); });
+    }
+
+    /**
+     * @brief 尝试批量推入元素（非阻塞）
+     *
+     * @details
+     * - 先扫描从 _tail 开始连续可写的 slot，再用一次 CAS 抢占整段区间
+     * - 抢占成功后依次构造元素并逐个发布，消费者可立即看到已发布的前缀
+     * - 空间不足时只推入能容纳的前缀，剩余元素由调用者决定如何处理
+     * - 元素以 T(*it) 构造；传入 std::make_move_iterator 即可移动推入
+     *
+     * @param first 待推入区间起点
+     * @param last  待推入区间终点
+     *
+     * @return 实际推入的元素数量；0 表示队列已满或发生并发竞争
+     *
+     * @thread_safety 线程安全 / 协程安全（非阻塞）
+     * @author BUG
+     * @date 2025-12-22
+     */
+    template<typename It>
+    inline size_t TryPushBulk(It first, It last) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        size_t want = static_cast<size_t>(std::distance(first, last));
+        if (want > nodes_.size()) want = nodes_.size();
 
-        size_t index = head % nodes_.size();
-        Node& node = nodes_[index];
+        size_t count = 0;
+        intptr_t diff = 0;
+        while (count < want) {
+            size_t seq = nodes_[(tail + count) & _mask].sequence.load(std::memory_order_acquire);
+            diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail + count);
+            if (diff != 0) break;
+            ++count;
+        }
+        if (count == 0) {
+            // 与 TryEmplace 相同：首个 slot 仍被上一轮占用为 Full，其他生产者已抢先推进 _tail 为 Busy
+            if (want > 0) {
+                if (diff < 0) {
+                    _metrics.AddPushFull();
+                } else {
+                    _metrics.AddPushBusy();
+                }
+            }
+            return 0;
+        }
 
-        size_t seq = node.sequence.load(std::memory_order_acquire);
-        if (seq != head + 1) {
-            if (_head.load(std::memory_order_relaxed)
-                == _tail.load(std::memory_order_relaxed)) {
-                return RingQueueResult::Empty;
+        if constexpr (P == Producers::Multi) {
+            if (!_tail.compare_exchange_strong(
+                    tail, tail + count,
+                    std::memory_order_relaxed,
+                    std::memory_order_relaxed)) {
+                _metrics.AddPushBusy();
+                return 0;
             }
-            return RingQueueResult::Busy;
+        } else {
+            _tail.store(tail + count, std::memory_order_release);
         }
 
-        if (!_head.compare_exchange_strong(
-                head, head + 1,
-                std::memory_order_acq_rel,
-                std::memory_order_relaxed)) {
-            return RingQueueResult::Busy;
+        for (size_t i = 0; i < count; ++i, ++first) {
+            Node& node = nodes_[(tail + i) & _mask];
+            ::new (static_cast<void*>(node.storage)) T(*first);
+            node.sequence.store(tail + i + 1, std::memory_order_release);
         }
+        return count;
+    }
 
-        item = node.data;
-        node.sequence.store(
-            head + nodes_.size(),
-            std::memory_order_release);
+    /**
+     * @brief 尝试批量弹出元素（非阻塞）
+     *
+     * @details
+     * - 先扫描从 _head 开始连续已发布的 slot，再用一次 CAS 抢占整段区间
+     * - 抢占成功后依次将元素移动赋值到 *out++，析构并归还 slot
+     *
+     * @param out 输出迭代器（如 std::back_inserter）
+     * @param max 最多弹出的元素数量
+     *
+     * @return 实际弹出的元素数量；0 表示队列为空或发生并发竞争
+     *
+     * @thread_safety 线程安全 / 协程安全（非阻塞）
+     * @author BUG
+     * @date 2025-12-22
+     */
+    template<typename OutIt>
+    inline size_t TryPopBulk(OutIt out, size_t max) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (max > nodes_.size()) max = nodes_.size();
 
-        return RingQueueResult::Ok;
+        size_t count = 0;
+        while (count < max) {
+            size_t seq = nodes_[(head + count) & _mask].sequence.load(std::memory_order_acquire);
+            if (seq != head + count + 1) break;
+            ++count;
+        }
+        if (count == 0) return 0;
+
+        if constexpr (C == Consumers::Multi) {
+            if (!_head.compare_exchange_strong(
+                    head, head + count,
+                    std::memory_order_relaxed,
+                    std::memory_order_relaxed)) {
+                _metrics.AddPopBusy();
+                return 0;
+            }
+        } else {
+            _head.store(head + count, std::memory_order_release);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            Node& node = nodes_[(head + i) & _mask];
+            T* value = node.Ptr();
+            *out = std::move(*value);
+            ++out;
+            value->~T();
+            node.sequence.store(
+                head + i + nodes_.size(),
+                std::memory_order_release);
+        }
+        return count;
     }
 
     /**
@@ -272,13 +490,98 @@ public:
         return (tail - head) >= nodes_.size();
     }
 
+    /**
+     * @brief 获取失败路径计数（Full / Busy）
+     * @details
+     * - 仅在 -DEXECUTOR_METRICS 时计数，否则恒为 0
+     * - 可在任意线程调用，各分片求和，结果为近似快照
+     * @return RingQueueStats
+     * @author BUG
+     * @date 2025-12-29
+     */
+    inline RingQueueStats Stats() const {
+        return _metrics.Snapshot();
+    }
+
 private:
-    struct Node {
-        T data;
+    /**
+     * @brief 将容量向上取整为 2 的幂
+     * @param capacity 期望容量
+     * @return 不小于 capacity 的最小 2 的幂（至少为 1）
+     */
+    static size_t RoundUpPowerOfTwo(size_t capacity) {
+        size_t n = 1;
+        while (n < capacity) n <<= 1;
+        return n;
+    }
+
+    /**
+     * @brief 弹出核心逻辑
+     * @details 抢占 slot 后将元素以右值交给 sink，再析构 slot 中的对象并归还 slot
+     * @param sink 接收元素的可调用对象，签名为 void(T&&)
+     */
+    template<typename Sink>
+    inline RingQueueResult TryConsume(Sink&& sink) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        Node& node = nodes_[head & _mask];
+
+        size_t seq = node.sequence.load(std::memory_order_acquire);
+        intptr_t diff =
+            static_cast<intptr_t>(seq) - static_cast<intptr_t>(head + 1);
+
+        if (diff != 0) {
+            // slot 尚未写入：可能为空，也可能生产者已占位但未发布
+            if (diff < 0) {
+                if (head == _tail.load(std::memory_order_acquire)) {
+                    return RingQueueResult::Empty;
+                }
+            }
+            _metrics.AddPopBusy();
+            return RingQueueResult::Busy;
+        }
+
+        if constexpr (C == Consumers::Multi) {
+            if (!_head.compare_exchange_strong(
+                    head, head + 1,
+                    std::memory_order_relaxed,
+                    std::memory_order_relaxed)) {
+                _metrics.AddPopBusy();
+                return RingQueueResult::Busy;
+            }
+        } else {
+            _head.store(head + 1, std::memory_order_release);
+        }
+
+        T* value = node.Ptr();
+        sink(std::move(*value));
+        value->~T();
+        node.sequence.store(
+            head + nodes_.size(),
+            std::memory_order_release);
+
+        return RingQueueResult::Ok;
+    }
+
+    /// 节点：未初始化的对齐存储 + 序号，元素仅在 slot 被占用期间存活
+    struct PackedNode {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic<size_t> sequence;
+
+        T* Ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    struct alignas(kCacheLineSize) PaddedNode {
+        alignas(T) unsigned char storage[sizeof(T)];
         std::atomic<size_t> sequence;
+
+        T* Ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
     };
 
-    std::atomic<size_t> _head;
-    std::atomic<size_t> _tail;
+    using Node = std::conditional_t<L == NodeLayout::Padded, PaddedNode, PackedNode>;
+
+    alignas(kCacheLineSize) std::atomic<size_t> _head; ///< 消费者游标（独占 cache line）
+    alignas(kCacheLineSize) std::atomic<size_t> _tail; ///< 生产者游标（独占 cache line）
+    alignas(kCacheLineSize) const size_t _mask;        ///< 容量掩码（capacity - 1）
     std::vector<Node> nodes_;
+    RingQueueMetrics _metrics; ///< 失败路径计数（EXECUTOR_METRICS 关闭时为空类型）
 };
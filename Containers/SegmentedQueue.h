@@ -0,0 +1,270 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+#include <cstddef>
+#include <Containers/RingQueue.h>
+
+/**
+ * @class SegmentedQueue
+ * @brief 无界多生产者 / 单消费者（MPSC）分段队列
+ *
+ * @details
+ * 结构：
+ * - 队列由定长 segment 组成的单向链表构成，每个 segment 含 segmentSize 个 slot
+ * - 生产者对尾 segment 的 claimed 执行一次 fetch_add 领取 slot，无 CAS 重试
+ * - segment 写满时由第一个越界的生产者分配并链接下一个 segment，
+ *   内存分配被摊薄到每 segmentSize 个元素一次
+ * - 消费者独占头部，按 slot 的 ready 标志依次取出，不执行任何 RMW
+ *
+ * 内存回收：
+ * - 消费完的 segment 先挂入回收链表
+ * - 只有当尾指针已越过它且没有生产者处于 TryPush 中时才真正释放，
+ *   因此生产者读取到的 segment 指针永远有效
+ *
+ * 与 RingQueue 相同的 Try 语义：
+ * - TryPush 永远不会返回 Full（仅在内存耗尽时由 new 终止）
+ * - TryPop 在生产者已领取 slot 但尚未发布时返回 Busy
+ *
+ * @tparam T 元素类型
+ * @author BUG
+ * @date 2025-12-25
+ */
+template<typename T>
+class SegmentedQueue {
+public:
+    static constexpr Producers kProducers = Producers::Multi;
+    static constexpr Consumers kConsumers = Consumers::Single;
+
+    /**
+     * @brief 构造函数
+     * @param segmentSize 每个 segment 的 slot 数量
+     */
+    explicit SegmentedQueue(size_t segmentSize = 256)
+        : _segmentSize(segmentSize > 0 ? segmentSize : 1)
+    {
+        Segment* first = new Segment(_segmentSize, 0);
+        _tail.store(first, std::memory_order_relaxed);
+        _head = first;
+    }
+
+    /**
+     * @brief 析构函数
+     * @details 析构剩余元素并释放所有 segment。析构前必须保证没有并发访问
+     */
+    ~SegmentedQueue() {
+        Segment* seg = _head;
+        size_t index = _headIndex;
+        while (seg) {
+            size_t claimed = seg->claimed.load(std::memory_order_relaxed);
+            size_t end = claimed < _segmentSize ? claimed : _segmentSize;
+            for (; index < end; ++index) {
+                if (seg->slots[index].ready.load(std::memory_order_relaxed)) {
+                    seg->slots[index].Ptr()->~T();
+                }
+            }
+            Segment* next = seg->next.load(std::memory_order_relaxed);
+            delete seg;
+            seg = next;
+            index = 0;
+        }
+        FreeRetired(true);
+    }
+
+    SegmentedQueue(const SegmentedQueue&) = delete;
+    SegmentedQueue& operator=(const SegmentedQueue&) = delete;
+
+    /**
+     * @brief 推入元素（拷贝）
+     * @return RingQueueResult::Ok
+     * @thread_safety 任意线程可并发调用
+     */
+    inline RingQueueResult TryPush(const T& item) {
+        return TryEmplace(item);
+    }
+
+    /**
+     * @brief 推入元素（移动）
+     * @return RingQueueResult::Ok
+     * @thread_safety 任意线程可并发调用
+     */
+    inline RingQueueResult TryPush(T&& item) {
+        return TryEmplace(std::move(item));
+    }
+
+    /**
+     * @brief 在领取到的 slot 上原地构造元素
+     *
+     * @return RingQueueResult::Ok
+     * @thread_safety 任意线程可并发调用
+     */
+    template<typename... Args>
+    inline RingQueueResult TryEmplace(Args&&... args) {
+        _producers.fetch_add(1, std::memory_order_seq_cst);
+        Segment* seg = _tail.load(std::memory_order_seq_cst);
+
+        while (true) {
+            size_t index = seg->claimed.fetch_add(1, std::memory_order_relaxed);
+            if (index < _segmentSize) {
+                Slot& slot = seg->slots[index];
+                ::new (static_cast<void*>(slot.storage)) T(std::forward<Args>(args)...);
+                slot.ready.store(true, std::memory_order_release);
+                break;
+            }
+
+            Segment* next = seg->next.load(std::memory_order_acquire);
+            if (!next) {
+                Segment* fresh = new Segment(_segmentSize, seg->base + _segmentSize);
+                if (seg->next.compare_exchange_strong(
+                        next, fresh,
+                        std::memory_order_acq_rel,
+                        std::memory_order_acquire)) {
+                    next = fresh;
+                } else {
+                    delete fresh;
+                }
+            }
+
+            Segment* expected = seg;
+            _tail.compare_exchange_strong(
+                expected, next,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed);
+            seg = next;
+        }
+
+        _producers.fetch_sub(1, std::memory_order_release);
+        return RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 弹出元素（移动赋值）
+     *
+     * @return
+     * - RingQueueResult::Ok     弹出成功
+     * - RingQueueResult::Empty  队列为空
+     * - RingQueueResult::Busy   下一个元素已被领取但尚未发布，可重试
+     *
+     * @thread_safety 仅消费者线程调用
+     */
+    inline RingQueueResult TryPop(T& item) {
+        return TryConsume([&](T&& value) { item = std::move(value); });
+    }
+
+    /**
+     * @brief 弹出元素到 optional
+     * @return 同 TryPop(T&)
+     * @thread_safety 仅消费者线程调用
+     */
+    inline RingQueueResult TryPop(std::optional<T>& item) {
+        return TryConsume([&](T&& value) { item.emplace(std::move(value)); });
+    }
+
+    /**
+     * @brief 获取当前元素数量（近似值）
+     * @note 仅用于监控 / 调试，任意线程可调用
+     */
+    inline size_t SizeApprox() const {
+        _producers.fetch_add(1, std::memory_order_seq_cst);
+        const Segment* seg = _tail.load(std::memory_order_seq_cst);
+        size_t claimed = seg->claimed.load(std::memory_order_relaxed);
+        size_t pushed = seg->base + (claimed < _segmentSize ? claimed : _segmentSize);
+        _producers.fetch_sub(1, std::memory_order_release);
+
+        size_t popped = _popped.load(std::memory_order_relaxed);
+        return pushed > popped ? pushed - popped : 0;
+    }
+
+    /**
+     * @brief 判断队列是否为空（近似判断）
+     */
+    inline bool IsEmptyApprox() const {
+        return SizeApprox() == 0;
+    }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic<bool> ready{false}; ///< 元素已构造完成
+
+        T* Ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    struct Segment {
+        Segment(size_t size, size_t baseIndex)
+            : base(baseIndex)
+            , slots(new Slot[size]) {}
+
+        alignas(kCacheLineSize) std::atomic<size_t> claimed{0};    ///< 已领取的 slot 数（可超过 segmentSize）
+        alignas(kCacheLineSize) std::atomic<Segment*> next{nullptr};
+        const size_t base;                                         ///< 第一个 slot 的全局序号
+        std::unique_ptr<Slot[]> slots;
+        Segment* retiredNext = nullptr;                            ///< 回收链表（仅消费者访问）
+    };
+
+    template<typename Sink>
+    inline RingQueueResult TryConsume(Sink&& sink) {
+        if (_headIndex == _segmentSize) {
+            Segment* next = _head->next.load(std::memory_order_acquire);
+            if (!next) return RingQueueResult::Empty;
+            Retire(_head);
+            _head = next;
+            _headIndex = 0;
+        }
+        if (_retired) FreeRetired(false);
+
+        Slot& slot = _head->slots[_headIndex];
+        if (!slot.ready.load(std::memory_order_acquire)) {
+            return _head->claimed.load(std::memory_order_relaxed) > _headIndex
+                ? RingQueueResult::Busy
+                : RingQueueResult::Empty;
+        }
+
+        T* value = slot.Ptr();
+        sink(std::move(*value));
+        value->~T();
+        slot.ready.store(false, std::memory_order_relaxed);
+        ++_headIndex;
+        _popped.store(_popped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return RingQueueResult::Ok;
+    }
+
+    void Retire(Segment* seg) {
+        seg->retiredNext = _retired;
+        _retired = seg;
+    }
+
+    /**
+     * @brief 释放已回收的 segment
+     * @param force 析构时无条件释放
+     */
+    void FreeRetired(bool force) {
+        if (!force) {
+            // 顺序与 TryEmplace 中「登记 → 读尾指针」相反，构成 Dekker 式配对：
+            // 看到尾指针已前移且没有生产者在途，则之后的生产者只会读到更新的尾
+            Segment* tail = _tail.load(std::memory_order_seq_cst);
+            if (_producers.load(std::memory_order_seq_cst) != 0) return;
+            for (Segment* seg = _retired; seg; seg = seg->retiredNext) {
+                if (seg == tail) return;
+            }
+        }
+        while (_retired) {
+            Segment* next = _retired->retiredNext;
+            delete _retired;
+            _retired = next;
+        }
+    }
+
+    const size_t _segmentSize;
+
+    alignas(kCacheLineSize) std::atomic<Segment*> _tail;        ///< 生产者端
+    alignas(kCacheLineSize) mutable std::atomic<size_t> _producers{0}; ///< 处于 TryPush 中的生产者数量
+
+    alignas(kCacheLineSize) Segment* _head = nullptr;           ///< 消费者端
+    size_t _headIndex = 0;
+    Segment* _retired = nullptr;
+    std::atomic<size_t> _popped{0};                             ///< 已弹出元素数（仅消费者写入）
+};
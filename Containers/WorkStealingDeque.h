@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <new>
+#include <optional>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <Containers/RingQueue.h>
+
+/**
+ * @class WorkStealingDeque
+ * @brief 有界 Chase-Lev 工作窃取双端队列
+ *
+ * @details
+ * 访问模型：
+ * - 所有者（owner）线程在底部 TryPush / TryPop，LIFO，热路径无 CAS
+ * - 任意窃取者（thief）线程在顶部 TrySteal，FIFO，通过一次 CAS 竞争
+ * - 只有在争抢最后一个元素时所有者才需要 CAS
+ *
+ * 与经典 Chase-Lev 的差异：
+ * - 容量固定（向上取整为 2 的幂），满时 TryPush 返回 Full，由上层决定溢出策略
+ * - 元素存放在未初始化存储中，窃取者在 CAS 成功【之后】才移动元素，
+ *   因此 T 不必可平凡拷贝；slot 在元素被移走前保持占用，所有者不会覆盖它
+ *
+ * @tparam T 元素类型
+ * @author BUG
+ * @date 2025-12-22
+ */
+template<typename T>
+class WorkStealingDeque {
+public:
+    /**
+     * @brief 构造函数
+     * @param capacity 队列容量，会向上取整为 2 的幂
+     */
+    explicit WorkStealingDeque(size_t capacity)
+        : _mask(RoundUpPowerOfTwo(capacity) - 1)
+        , _slots(_mask + 1)
+    {
+        for (auto& slot : _slots) {
+            slot.occupied.store(false, std::memory_order_relaxed);
+        }
+        _top.store(0, std::memory_order_relaxed);
+        _bottom.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 析构函数
+     * @details 析构剩余元素。析构前必须保证没有并发访问
+     */
+    ~WorkStealingDeque() {
+        for (auto& slot : _slots) {
+            if (slot.occupied.load(std::memory_order_relaxed)) {
+                slot.Ptr()->~T();
+            }
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief 所有者在底部推入元素
+     *
+     * @param item 要推入的元素，仅成功时被移动
+     *
+     * @return
+     * - RingQueueResult::Ok    推入成功
+     * - RingQueueResult::Full  队列已满（或目标 slot 仍在被窃取者移出）
+     *
+     * @thread_safety 仅所有者线程调用
+     */
+    template<typename U>
+    inline RingQueueResult TryPush(U&& item) {
+        int64_t b = _bottom.load(std::memory_order_relaxed);
+        int64_t t = _top.load(std::memory_order_acquire);
+
+        if (b - t >= static_cast<int64_t>(_slots.size())) {
+            return RingQueueResult::Full;
+        }
+
+        Slot& slot = _slots[static_cast<size_t>(b) & _mask];
+        if (slot.occupied.load(std::memory_order_acquire)) {
+            return RingQueueResult::Full;
+        }
+
+        ::new (static_cast<void*>(slot.storage)) T(std::forward<U>(item));
+        slot.occupied.store(true, std::memory_order_relaxed);
+        _bottom.store(b + 1, std::memory_order_release);
+        return RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 所有者从底部弹出元素（LIFO）
+     *
+     * @param item 接收元素
+     *
+     * @return
+     * - RingQueueResult::Ok     弹出成功
+     * - RingQueueResult::Empty  队列为空或最后一个元素被窃取
+     *
+     * @thread_safety 仅所有者线程调用
+     */
+    inline RingQueueResult TryPop(std::optional<T>& item) {
+        int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = _top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return RingQueueResult::Empty;
+        }
+
+        if (t == b) {
+            // 最后一个元素：与窃取者竞争 top
+            bool won = _top.compare_exchange_strong(
+                t, t + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed);
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            if (!won) return RingQueueResult::Empty;
+        }
+
+        MoveOut(_slots[static_cast<size_t>(b) & _mask], item);
+        return RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 窃取者从顶部窃取元素（FIFO）
+     *
+     * @param item 接收元素
+     *
+     * @return
+     * - RingQueueResult::Ok     窃取成功
+     * - RingQueueResult::Empty  队列为空
+     * - RingQueueResult::Busy   与其他窃取者或所有者竞争失败，可重试
+     *
+     * @thread_safety 任意线程可调用
+     */
+    inline RingQueueResult TrySteal(std::optional<T>& item) {
+        int64_t t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = _bottom.load(std::memory_order_acquire);
+
+        if (t >= b) {
+            return RingQueueResult::Empty;
+        }
+
+        if (!_top.compare_exchange_strong(
+                t, t + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed)) {
+            return RingQueueResult::Busy;
+        }
+
+        MoveOut(_slots[static_cast<size_t>(t) & _mask], item);
+        return RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 获取当前元素数量（近似值）
+     * @note 仅用于监控 / 调试
+     */
+    inline size_t SizeApprox() const {
+        int64_t b = _bottom.load(std::memory_order_acquire);
+        int64_t t = _top.load(std::memory_order_acquire);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+    /**
+     * @brief 获取容量
+     */
+    inline size_t Capacity() const {
+        return _slots.size();
+    }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic<bool> occupied; ///< 元素被移出并析构后才会清除
+
+        T* Ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    static size_t RoundUpPowerOfTwo(size_t capacity) {
+        size_t n = 1;
+        while (n < capacity) n <<= 1;
+        return n;
+    }
+
+    static void MoveOut(Slot& slot, std::optional<T>& item) {
+        T* value = slot.Ptr();
+        item.emplace(std::move(*value));
+        value->~T();
+        slot.occupied.store(false, std::memory_order_release);
+    }
+
+    alignas(kCacheLineSize) std::atomic<int64_t> _top;    ///< 窃取端（多线程竞争）
+    alignas(kCacheLineSize) std::atomic<int64_t> _bottom; ///< 所有者端
+    alignas(kCacheLineSize) const size_t _mask;
+    std::vector<Slot> _slots;
+};
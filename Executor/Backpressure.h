@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <Containers/RingQueue.h>
+#include <Executor/EventCount.h>
+
+inline constexpr size_t kBackpressureSpins = 64;  ///< 队列满时 CpuRelax 重试次数
+inline constexpr size_t kBackpressureYields = 16; ///< 自旋后 yield 重试次数，之后停车
+
+/**
+ * @brief 提交侧的在途登记（RAII）
+ *
+ * @details
+ * 提交先登记、再检查 Runtime 是否运行、再入队；Stop() 清除运行标志后等待计数归零。
+ * 两侧都使用 seq_cst，因此要么提交看到已停止而放弃，要么 Stop() 等到它入队完成，
+ * 不会有任务在 Stop() 返回后才落入无人消费的队列。
+ */
+class InFlightGuard {
+public:
+    explicit InFlightGuard(std::atomic<size_t>& count)
+        : _count(count) {
+        _count.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    ~InFlightGuard() {
+        _count.fetch_sub(1, std::memory_order_release);
+    }
+
+    InFlightGuard(const InFlightGuard&) = delete;
+    InFlightGuard& operator=(const InFlightGuard&) = delete;
+
+private:
+    std::atomic<size_t>& _count;
+};
+
+/**
+ * @brief 生产者侧背压：等待有界队列出现空位后提交
+ *
+ * @details
+ * 按代价递增的阶段重试 tryOnce()：
+ *   1. Busy（与其他生产者竞争失败）：CpuRelax 后立即重试，不进入退避
+ *   2. Full：先自旋 kBackpressureSpins 次，再 yield kBackpressureYields 次
+ *   3. 仍然满：在 space 上停车，协议与消费者停车相同：
+ *      PrepareWait → 再试一次 → Wait / WaitFor，直到消费者取走任务后 Notify
+ *
+ * running() 为 false 且 tryOnce() 返回 Full 时返回 false：不会再有消费者腾出空位。
+ * tryOnce() 应在 Runtime 未运行时直接返回 Full（见 InFlightGuard），避免任务落入无人消费的队列。
+ * 停止 Runtime 时必须 space.NotifyAll()，唤醒所有停车中的生产者。
+ *
+ * @param space    消费者取走任务后通知的 EventCount
+ * @param tryOnce  单次提交尝试，返回 RingQueueResult；只在 Ok 时消耗任务，因此可反复调用
+ * @param running  Runtime 是否仍在运行
+ * @param deadline 截止时间；std::nullopt 表示无限等待
+ *
+ * @return true 已入队；false 超时或 Runtime 已停止（任务未被消耗）
+ *
+ * @author BUG
+ * @date 2025-12-29
+ */
+template<typename TryOnce, typename Running>
+bool SubmitWithBackpressure(
+    EventCount& space,
+    TryOnce&& tryOnce,
+    Running&& running,
+    std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt)
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t fullRounds = 0;
+    while (true) {
+        RingQueueResult r = tryOnce();
+        if (r == RingQueueResult::Ok) return true;
+        if (r == RingQueueResult::Busy) {
+            CpuRelax();
+            continue;
+        }
+
+        if (!running()) return false;
+        if (deadline && Clock::now() >= *deadline) return false;
+
+        ++fullRounds;
+        if (fullRounds <= kBackpressureSpins) {
+            CpuRelax();
+            continue;
+        }
+        if (fullRounds <= kBackpressureSpins + kBackpressureYields) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        auto key = space.PrepareWait();
+        r = tryOnce();
+        if (r == RingQueueResult::Ok) {
+            space.CancelWait();
+            return true;
+        }
+        if (r == RingQueueResult::Busy || !running()) {
+            space.CancelWait();
+            continue;
+        }
+
+        if (deadline) {
+            auto now = Clock::now();
+            if (now >= *deadline) {
+                space.CancelWait();
+                return false;
+            }
+            space.WaitFor(key, *deadline - now);
+        } else {
+            space.Wait(key);
+        }
+    }
+}
@@ -23,10 +23,9 @@ public:
     /// Runtime 执行入口
     void operator()() {
         _fn();
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _done = true;
-        }
+        // 持锁通知：等待者返回后可能立即销毁本对象（通常位于其栈上）
+        std::lock_guard<std::mutex> lock(_mutex);
+        _done = true;
         _cv.notify_one();
     }
 
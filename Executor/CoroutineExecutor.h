@@ -4,6 +4,16 @@
 #include <vector>
 #include <atomic>
 #include <thread>
+#include <utility>
+#include <type_traits>
+#include <optional>
+#include <chrono>
+#include <Containers/CacheLine.h>
+#include <Executor/Future.h>
+#include <Executor/EventCount.h>
+#include <Executor/Backpressure.h>
+#include <Executor/SchedulerStats.h>
+#include <Executor/LockFreeExecutor.h>
 
 /**
  * @class CoroutineExecutor
@@ -26,6 +36,7 @@
  * - 单 OS 线程
  * - 多个消费者协程
  * - 协程主动让出执行权（co_await）
+ * - 事件驱动：调度线程取到任务后才恢复一个消费协程，空闲时不恢复任何协程
  *
  * ============================================================
  * 三、与 ThreadExecutor 的核心区别
@@ -45,8 +56,9 @@
  *
  * 1. 不创建多个 OS 线程
  * 2. 不使用 condition_variable
- * 3. 不阻塞
+ * 3. 协程不阻塞；只有调度线程在队列为空时于 EventCount 上停车
  * 4. 所有切换点必须显式 co_await
+ * 5. 任务必须经由 TrySubmit / Submit 提交，否则停车中的调度线程不会被唤醒
  *
  * ============================================================
  * 五、适用场景（Use Case）
@@ -55,6 +67,7 @@
  * - IO 密集型
  * - Actor / 消息驱动模型
  * - 游戏主循环
+ * - 配合 CoTask（Executor/CoroutineTask.h）：co_await Schedule() / SubmitAsync()
  *
  * ============================================================
  */
@@ -96,7 +109,7 @@ public:
      *
      * 1. 创建 consumer 协程
      * 2. 创建调度线程
-     * 3. 调度线程轮询 resume 协程
+     * 3. 调度线程取到任务后 resume 一个协程
      */
     void Start() {
         if (_running.exchange(true))
@@ -113,32 +126,228 @@ public:
      * @brief 停止 Runtime
      *
      * @details
-     * - 设置运行标志
-     * - 等待调度线程退出
+     * - 设置运行标志，此后的提交都被拒绝
+     * - 等待已通过运行检查的提交完成入队
+     * - 唤醒并等待调度线程退出
+     * - 结束并销毁所有消费协程
+     * - 析构仍留在队列中的任务
      *
      * @note
-     * 不保证所有任务执行完成
+     * 不保证所有任务执行完成：未执行的任务被丢弃，其中的 Promise 随之以 broken_promise 完成；
+     * 经 Schedule() 挂起、尚未恢复的协程不会再被恢复
      */
     void Stop() {
-        if (!_running.exchange(false))
+        if (!_running.exchange(false, std::memory_order_seq_cst))
             return;
 
+        while (_inFlight.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+
+        _parking.NotifyAll();
+        _space.NotifyAll();
+
         if (_worker.joinable())
             _worker.join();
+
+        // 调度线程已退出：以空任务恢复每个协程，使其走到 final_suspend 后销毁
+        _current.reset();
+        for (auto& t : _tasks) {
+            if (t.h && !t.h.done())
+                t.h.resume();
+            if (t.h)
+                t.h.destroy();
+        }
+        _tasks.clear();
+
+        while (_executor.TryPop(_current)) _current.reset();
     }
 
     /**
-     * @brief 提交任务
+     * @brief 尝试提交任务（不等待）
      *
      * @details
-     * - 非阻塞
+     * - 非阻塞，只尝试一次
      * - 仅转发到 Executor
+     *
+     * @return false Runtime 未运行、队列已满或竞争失败
+     */
+    bool TrySubmit(const Task& task) {
+        return Offer(task) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试提交任务（移动，不等待）
+     *
+     * @details
+     * - 非阻塞
+     * - 失败时 task 保持原样，可直接重试
+     */
+    bool TrySubmit(Task&& task) {
+        return Offer(std::move(task)) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 提交任务，队列满时等待空位
+     *
+     * @details
+     * - 竞争失败立即重试；队列满时自旋 → yield → 停车，直到调度线程取走任务后唤醒
+     * - 在调度线程（含其上的协程）内调用且队列已满时直接执行 task（caller-runs），
+     *   调度线程是唯一的消费者，等待只会自锁
+     *
+     * @return false 仅当 Runtime 未运行（未 Start() 或已 Stop()），task 保持原样
      */
     bool Submit(const Task& task) {
-        return _executor.Add(task);
+        return SubmitUntil(task, std::nullopt);
+    }
+
+    /**
+     * @brief 提交任务（移动），队列满时等待空位
+     */
+    bool Submit(Task&& task) {
+        return SubmitUntil(std::move(task), std::nullopt);
+    }
+
+    /**
+     * @brief 提交任务，队列满时最多等待 timeout
+     * @return false 超时或 Runtime 已停止，task 保持原样
+     */
+    template<typename Rep, typename Period>
+    bool SubmitFor(const Task& task, std::chrono::duration<Rep, Period> timeout) {
+        return SubmitUntil(task, std::chrono::steady_clock::now() + timeout);
+    }
+
+    /**
+     * @brief 提交任务（移动），队列满时最多等待 timeout
+     */
+    template<typename Rep, typename Period>
+    bool SubmitFor(Task&& task, std::chrono::duration<Rep, Period> timeout) {
+        return SubmitUntil(std::move(task), std::chrono::steady_clock::now() + timeout);
+    }
+
+    /**
+     * @brief 提交任务，队列满时在调用线程直接执行（caller-runs）
+     * @return true 已入队；false 队列已满或 Runtime 未运行，task 已在调用线程执行完毕
+     */
+    bool SubmitOrRun(const Task& task) {
+        return OfferOrRun(task);
+    }
+
+    /**
+     * @brief 提交任务（移动），队列满时在调用线程直接执行
+     */
+    bool SubmitOrRun(Task&& task) {
+        return OfferOrRun(std::move(task));
+    }
+
+    /**
+     * @brief 切换到本 Runtime 执行的 awaiter
+     *
+     * @details
+     * co_await exec.Schedule() 会挂起当前协程，
+     * 并把「恢复该协程」作为一个任务投递到 Executor 层的 RingQueue，
+     * 由消费协程取出后恢复，期间不会被轮询。
+     * 队列已满或 Runtime 未运行时不挂起，直接在当前线程继续执行。
+     */
+    auto Schedule() {
+        struct Awaiter {
+            CoroutineExecutor& exec;
+
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend(std::coroutine_handle<> h) {
+                return exec.TrySubmit(Task([h] { h.resume(); }));
+            }
+
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
+    }
+
+    /**
+     * @brief 非阻塞提交并返回结果 Future
+     *
+     * @details
+     * - 返回的 Future 可 co_await：等待者作为任务重新投递到本 Runtime 恢复
+     * - 也可调用 Then() / Get()
+     * - 队列满时按 Submit() 的背压语义等待空位（调度线程内调用时直接执行）；
+     *   Runtime 未运行时在调用线程执行，因此返回的 Future 总是 Valid()
+     * - fn 抛出的异常保存在 Future 中，Get() / co_await 时重新抛出
+     */
+    template<typename F, typename R = std::invoke_result_t<F&>>
+    Future<R> SubmitAsync(F fn) {
+        auto [promise, future] = MakePromise<R>(FutureExecutor::From(*this));
+        Task task(
+            [p = std::move(promise), fn = std::move(fn)]() mutable {
+                p.SetValueFrom(fn);
+            });
+        if (!Submit(std::move(task))) task();
+        return std::move(future);
+    }
+
+    /**
+     * @brief 获取调度计数快照
+     * @note 可在任意线程调用，不影响调度热路径
+     */
+    SchedulerStats Stats() const {
+        SchedulerStats stats;
+        _counters.AccumulateTo(stats);
+        return stats;
     }
 
 private:
+    /**
+     * @brief 单次提交尝试：入队并唤醒调度线程
+     * @details 运行检查与入队之间登记在 _inFlight 中（见 InFlightGuard）
+     * @return Runtime 未运行时为 Full；仅 Ok 时消耗 task
+     */
+    template<typename U>
+    RingQueueResult Offer(U&& task) {
+        InFlightGuard guard(_inFlight);
+        if (!_running.load(std::memory_order_seq_cst))
+            return RingQueueResult::Full;
+
+        RingQueueResult r = _executor.TryAdd(std::forward<U>(task));
+        if (r == RingQueueResult::Ok) _parking.NotifyOne();
+        return r;
+    }
+
+    /**
+     * @brief 等待空位直到入队或 deadline（见 Submit / SubmitFor）
+     */
+    template<typename U>
+    bool SubmitUntil(U&& task, std::optional<std::chrono::steady_clock::time_point> deadline) {
+        if (_tlsOwner == this) {
+            OfferOrRun(std::forward<U>(task));
+            return true;
+        }
+        return SubmitWithBackpressure(
+            _space,
+            [&] { return Offer(std::forward<U>(task)); },
+            [&] { return _running.load(std::memory_order_acquire); },
+            deadline);
+    }
+
+    /**
+     * @brief 入队，队列满时在当前线程执行（见 SubmitOrRun）
+     */
+    template<typename U>
+    bool OfferOrRun(U&& task) {
+        RingQueueResult r;
+        while ((r = Offer(std::forward<U>(task))) == RingQueueResult::Busy) {
+            CpuRelax();
+        }
+        if (r == RingQueueResult::Ok) return true;
+
+        if constexpr (std::is_const_v<std::remove_reference_t<U>>) {
+            Task copy(task);
+            copy();
+        } else {
+            task();
+        }
+        return false;
+    }
+
     /**
      * @brief 协程句柄封装
      *
@@ -168,10 +377,9 @@ private:
      * 执行语义：
      * ========================================================
      *
-     * while (running):
-     *   if TryPop 成功:
-     *       执行任务
-     *   co_await 挂起
+     * while (调度器交付了任务 _current):
+     *   执行任务
+     *   co_await 挂起，等待下一次交付
      *
      * ========================================================
      * 关键点：
@@ -179,14 +387,13 @@ private:
      *
      * - 没有阻塞
      * - 没有等待
-     * - 所有切换点可控
+     * - 协程只在确有任务时被恢复，从不空转
+     * - 以空 _current 恢复即退出
      */
     TaskHandle ConsumeLoop() {
-        while (_running.load()) {
-            Task task;
-            if (_executor.TryPop(task)) {
-                task();
-            }
+        while (_current) {
+            (*_current)();
+            _current.reset();
             co_await std::suspend_always{};
         }
     }
@@ -195,25 +402,64 @@ private:
      * @brief 协程调度循环
      *
      * @details
-     * - 在单线程中轮询 resume 所有协程
-     * - 类似 cooperative scheduler
+     * - 从 Executor 取出一个任务放入 _current，再轮转恢复一个消费协程执行它
+     * - 取不到任务时先自旋 kSpinCount 次，再在 EventCount 上停车，
+     *   直到 Submit / Stop 唤醒，空闲时不消耗 CPU
      */
     void SchedulerLoop() {
+        _tlsOwner = this;
+        size_t next = 0;
+        size_t spin = 0;
+
         while (_running.load()) {
-            for (auto& t : _tasks) {
-                if (t.h && !t.h.done())
-                    t.h.resume();
+            if (_executor.TryPop(_current)) {
+                _space.NotifyOne();
+                spin = 0;
+                if (_tasks.empty()) {
+                    (*_current)();
+                    _current.reset();
+                    continue;
+                }
+                _tasks[next].h.resume();
+                next = (next + 1) % _tasks.size();
+                _counters.AddResume();
+                continue;
             }
-            std::this_thread::yield();
+
+            _counters.AddEmptyPoll();
+            if (++spin < kSpinCount) {
+                CpuRelax();
+                continue;
+            }
+
+            spin = 0;
+            auto key = _parking.PrepareWait();
+            if (_executor.SizeApprox() > 0 || !_running.load()) {
+                _parking.CancelWait();
+                continue;
+            }
+            _parking.Wait(key);
         }
+
+        _tlsOwner = nullptr;
     }
 
 private:
+    static constexpr size_t kSpinCount = 64; ///< 停车前的自旋次数
+
+    static inline thread_local CoroutineExecutor* _tlsOwner = nullptr; ///< 当前线程所属的 Runtime（调度线程）
+
     LockFreeExecutor<Task>& _executor; ///< Executor 层
     std::atomic<bool> _running;        ///< Runtime 状态
 
     size_t _coroutineCount;            ///< 协程数量
     std::vector<TaskHandle> _tasks;    ///< 消费协程集合
+    std::optional<Task> _current;      ///< 调度器交付给消费协程的任务（仅调度线程访问）
 
     std::thread _worker;               ///< 调度线程
+    EventCount _parking;               ///< 调度线程停车/唤醒
+    EventCount _space;                 ///< 等待队列空位的生产者停车/唤醒（Submit / SubmitFor）
+    SchedulerCounters _counters;       ///< 调度计数
+
+    alignas(kCacheLineSize) std::atomic<size_t> _inFlight{0}; ///< 已通过运行检查、尚未完成入队的提交数
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <Executor/BlockingTask.h>
 #include <Executor/CoroutineExecutor.h>
 
@@ -8,22 +9,32 @@
  * @brief 基于 CoroutineExecutor 的阻塞提交语义
  *
  * @details
- * - 调用线程阻塞
+ * - 调用线程阻塞直到任务执行完成
+ * - 队列满时由 CoroutineExecutor::Submit 等待空位，任务不会被丢弃
+ * - Runtime 已停止、无法入队时在调用线程执行
  * - Runtime 内部仍是单线程多协程
  *
+ * @tparam Task CoroutineExecutor 的任务类型，需可由 void() 可调用对象构造
+ *
  * @author BUG
  */
+template<typename Task = std::function<void()>>
 class CoroutineExecutorBlocking {
 public:
-    explicit CoroutineExecutorBlocking(CoroutineExecutor& exec)
+    explicit CoroutineExecutorBlocking(CoroutineExecutor<Task>& exec)
         : _exec(exec) {}
 
+    /**
+     * @brief 提交并等待执行完成
+     * @note 不可在该 CoroutineExecutor 的调度线程内调用，否则会自锁
+     */
     void Submit(std::function<void()> fn) {
         BlockingTask task(std::move(fn));
-        _exec.Add(std::ref(task));
+        if (!_exec.Submit(Task([&task] { task(); })))
+            task();
         task.Wait();
     }
 
 private:
-    CoroutineExecutor& _exec;
+    CoroutineExecutor<Task>& _exec;
 };
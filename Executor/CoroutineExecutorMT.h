@@ -5,28 +5,38 @@
 #include <vector>
 #include <atomic>
 #include <functional>
-#include <condition_variable>
-#include <mutex>
+#include <memory>
 #include <chrono>
+#include <type_traits>
+#include <iterator>
+#include <Containers/RingQueue.h>
+#include <Executor/EventCount.h>
+#include <Executor/Backpressure.h>
+#include <Executor/SchedulerStats.h>
+#include <Executor/ExecutorLanes.h>
+#include <Executor/ExecutorMetrics.h>
+#include <Executor/ThreadConfig.h>
 
 /**
  * @class DefaultBackoffPolicy
- * @brief 默认退避策略（Spin → Yield → Sleep）
+ * @brief 默认退避策略（Spin → Yield）
  *
  * @details
- * 用于 Runtime 在“无任务进展”时降低 CPU 占用。
+ * 用于 Runtime 在“无任务进展”时、停车之前降低 CPU 占用。
  * 属于调度策略层，而非 Runtime 内核。
+ *
+ * 只有「就绪队列与任务队列都为空」才算一次 miss，
+ * 空闲协程不会被恢复，也不会被计为进展。
+ * 连续 miss 达到 CoroutineExecutorMT::kParkAfter 后不再调用退避策略，
+ * 工作线程改为在 EventCount 上停车。
  */
 class DefaultBackoffPolicy {
 public:
     void operator()(size_t missCount) {
         if (missCount < 50) {
             // 短暂自旋
-        } else if (missCount < 200) {
-            std::this_thread::yield();
         } else {
-            std::this_thread::sleep_for(
-                std::chrono::microseconds(50));
+            std::this_thread::yield();
         }
     }
 };
@@ -41,6 +51,16 @@ public:
  * - 每线程多个协程
  * - 协程协作式调度
  * - 线程抢占式调度
+ * - 事件驱动：只有取到任务或就绪句柄时才恢复协程
+ *
+ * 空闲等待：连续 kParkAfter 次空轮询内交给 BackoffPolicy（自旋 / 让出），
+ * 之后在 EventCount 上停车直到被唤醒，空闲期间不消耗 CPU、不恢复任何协程：
+ * - TrySubmit / Submit / TrySubmitTo 入队后唤醒一个停车的工作线程
+ * - Schedule() 入队后唤醒一个停车的工作线程
+ * - 绕过 Runtime 直接推入 LockFreeQueue 的生产者必须随后调用 Notify()，否则停车中的工作线程不会被唤醒
+ *
+ * 优先级通道（可选）：SetLanes() 追加低优先级的外部队列，工作线程按严格优先级
+ * 或加权轮转选择通道（见 ExecutorLanes）；带截止时间的任务（Deadline()）出队后已过期则丢弃。
  *
  * 职责边界：
  * - ❌ 不存储任务
@@ -50,6 +70,9 @@ public:
  *
  * @tparam T                任务类型
  * @tparam LockFreeQueue    无锁队列类型（如 RingQueue<T>）
+ *                          - 单线程 Runtime 可使用 RingQueue<T, P, Consumers::Single>，
+ *                            同一线程内的协程不会并发进入 TryPop
+ *                          - 使用单消费者队列时 threadCount 会被限制为 1
  * @tparam BackoffPolicy    调度退避策略
  *
  * @author BUG
@@ -71,18 +94,27 @@ public:
      * @param cb                   任务处理回调
      * @param threadCount          工作线程数量
      * @param coroutinePerThread   每线程协程数量
+     * @param readyCapacity        被 Schedule() 挂起的协程句柄队列容量
      */
     CoroutineExecutorMT(
         LockFreeQueue& queue,
         Callback cb,
         size_t threadCount,
-        size_t coroutinePerThread)
+        size_t coroutinePerThread,
+        size_t readyCapacity = 1024)
         : _queue(queue)
         , _callback(std::move(cb))
         , _running(false)
         , _threadCount(threadCount)
         , _coroutinePerThread(coroutinePerThread)
-    {}
+        , _ready(readyCapacity)
+        , _metrics(threadCount)
+    {
+        if constexpr (IsSingleConsumerQueue<LockFreeQueue>::value) {
+            if (_threadCount > 1) _threadCount = 1;
+        }
+        _counters.reset(new SchedulerCounters[_threadCount]);
+    }
 
     /**
      * @brief 析构时自动停止 Runtime
@@ -100,7 +132,7 @@ public:
 
         for (size_t i = 0; i < _threadCount; ++i) {
             _threads.emplace_back(
-                &CoroutineExecutorMT::ThreadMain, this);
+                &CoroutineExecutorMT::ThreadMain, this, i);
         }
     }
 
@@ -108,10 +140,14 @@ public:
      * @brief 停止 Runtime
      */
     void Stop() {
-        if (!_running.exchange(false))
+        if (!_running.exchange(false, std::memory_order_seq_cst))
             return;
 
-        _cv.notify_all();
+        _parking.NotifyAll();
+        _space.NotifyAll();
+        while (_inFlight.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
 
         for (auto& t : _threads) {
             if (t.joinable())
@@ -120,7 +156,166 @@ public:
         _threads.clear();
     }
 
+    /**
+     * @brief 设置低优先级通道
+     *
+     * @details
+     * 构造时传入的 queue 为最高优先级的通道 0，lanes[i] 为通道 i + 1；
+     * weights 为各通道每轮的取出份额，空表示严格优先级（语义见 ExecutorLanes）
+     *
+     * @note
+     * - 只能在 Start() 之前调用
+     * - 队列的生命周期必须长于 Runtime
+     */
+    void SetLanes(std::vector<LockFreeQueue*> lanes, std::vector<uint32_t> weights = {}) {
+        _lanes = std::move(lanes);
+        _laneWeights = std::move(weights);
+    }
+
+    /**
+     * @brief 设置工作线程的命名 / CPU 绑定 / NUMA 内存策略（见 ThreadConfig）
+     * @note 只能在 Start() 之前调用
+     */
+    void SetThreadConfig(ThreadConfig config) {
+        _threadConfig = std::move(config);
+    }
+
+    /**
+     * @brief 尝试提交任务到通道 0（不等待）
+     *
+     * @details 仅在并发竞争（Busy）时重试；成功后唤醒一个停车的工作线程
+     *
+     * @return false Runtime 未运行或队列已满，task 保持原样
+     */
+    bool TrySubmit(const T& task) {
+        return Offer(task, 0) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试提交任务（移动，不等待），仅在成功时移动 task
+     */
+    bool TrySubmit(T&& task) {
+        return Offer(std::move(task), 0) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试提交任务到指定优先级通道（不等待）
+     * @details lane 0 为构造时传入的队列，lane 超出范围时投递到优先级最低的通道
+     */
+    bool TrySubmitTo(size_t lane, const T& task) {
+        return Offer(task, ClampLane(lane)) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试提交任务（移动）到指定优先级通道（不等待）
+     */
+    bool TrySubmitTo(size_t lane, T&& task) {
+        return Offer(std::move(task), ClampLane(lane)) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 提交任务到通道 0，队列满时等待空位
+     *
+     * @details
+     * - 队列满时自旋 → yield → 停车，直到工作线程取走任务后唤醒（见 SubmitWithBackpressure）
+     * - 在本 Runtime 的工作线程内调用且队列已满时直接在当前线程执行回调（caller-runs），避免自锁
+     *
+     * @return false Runtime 未运行，task 保持原样
+     */
+    bool Submit(const T& task) {
+        return SubmitUntil(task);
+    }
+
+    /**
+     * @brief 提交任务（移动），队列满时等待空位
+     */
+    bool Submit(T&& task) {
+        return SubmitUntil(std::move(task));
+    }
+
+    /**
+     * @brief 唤醒一个停车的工作线程
+     *
+     * @details
+     * 绕过 Runtime、直接推入外部队列（含 SetLanes() 的通道）的生产者必须在推入后调用；
+     * 没有停车的工作线程时只有一次 fence 与一次原子读，不进行系统调用。
+     */
+    void Notify() {
+        _parking.NotifyOne();
+    }
+
+    /**
+     * @brief 切换到本 Runtime 执行的 awaiter
+     *
+     * @details
+     * co_await exec.Schedule() 挂起当前协程，把句柄放入就绪队列，
+     * 由任一工作线程取出并恢复；就绪句柄只在被取出时恢复一次，不会被轮询。
+     * 就绪队列已满时不挂起，直接在当前线程继续执行。
+     *
+     * @note Stop() 后仍留在就绪队列中的协程不会再被恢复
+     */
+    auto Schedule() {
+        struct Awaiter {
+            CoroutineExecutorMT& exec;
+
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend(std::coroutine_handle<> h) {
+                // 入队成功后协程可能已在其他线程恢复并销毁本 awaiter，先取出 Runtime
+                CoroutineExecutorMT& runtime = exec;
+                if (runtime._ready.TryPush(h) != RingQueueResult::Ok)
+                    return false;
+                runtime._parking.NotifyOne();
+                return true;
+            }
+
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
+    }
+
+    /**
+     * @brief 获取所有工作线程的调度计数之和
+     * @note 可在任意线程调用，不影响调度热路径
+     */
+    SchedulerStats Stats() const {
+        SchedulerStats stats;
+        for (size_t i = 0; i < _threadCount; ++i) {
+            _counters[i].AccumulateTo(stats);
+        }
+        return stats;
+    }
+
+    /**
+     * @brief 获取运行指标快照
+     *
+     * @details
+     * - 仅在 -DEXECUTOR_METRICS 时计数，否则只有 queueDepth 有效
+     * - submitted / rejected 只统计经由 TrySubmit / Submit / TrySubmitTo 的提交；
+     *   直接推入外部队列的失败次数见队列自身的 RingQueue::Stats()
+     * - parks 为工作线程实际在 EventCount 上停车的次数（BackoffPolicy 的自旋 / 让出不计入）
+     * - 等待时间直方图只统计带入队时间戳的任务（如 TimedTask<T>，以构造时间为入队时间）
+     * - queueDepth 为所有通道的深度之和
+     */
+    ExecutorStats Metrics() const {
+        size_t depth = _queue.SizeApprox();
+        for (const LockFreeQueue* lane : _lanes) {
+            depth += lane->SizeApprox();
+        }
+        return _metrics.Snapshot(depth);
+    }
+
 private:
+    /**
+     * @brief 判断队列是否为单消费者 RingQueue
+     */
+    template<typename Q, typename = void>
+    struct IsSingleConsumerQueue : std::false_type {};
+
+    template<typename Q>
+    struct IsSingleConsumerQueue<Q, std::void_t<decltype(Q::kConsumers)>>
+        : std::bool_constant<Q::kConsumers == Consumers::Single> {};
+
     /**
      * @brief 协程封装类型
      */
@@ -144,66 +339,218 @@ private:
      * @brief 协程执行循环
      *
      * 协作式语义：
-     * - TryPop 成功 → 执行任务
-     * - TryPop 失败 → 主动让出执行权
+     * - 工作线程把取到的一批任务放入 batch 后恢复本协程
+     * - 依次执行整批任务，清空后主动让出执行权
+     * - 以空 batch 恢复即退出
+     *
+     * @param batch   所属工作线程的批量缓冲区
+     * @param metrics 所属工作线程的指标分片
      */
-    WorkerTask CoroutineLoop() {
-        while (_running.load(std::memory_order_relaxed)) {
-            T task;
-            if (_queue.TryPop(task) == RingQueueResult::Ok) {
-                _callback(task);
-            } else {
-                co_await std::suspend_always{};
-            }
+    WorkerTask CoroutineLoop(std::vector<T>& batch, WorkerMetrics& metrics) {
+        while (!batch.empty()) {
+            RunBatch(batch, metrics);
+            co_await std::suspend_always{};
         }
         co_return;
     }
 
+    /**
+     * @brief 依次执行并清空一批任务（已过期的任务丢弃）
+     */
+    void RunBatch(std::vector<T>& batch, WorkerMetrics& metrics) {
+        uint64_t start = metrics.Now();
+        for (const auto& task : batch) {
+            if (TaskExpired(task)) {
+                metrics.AddShed();
+                continue;
+            }
+            metrics.BeginTask(task, start);
+            _callback(task);
+            start = metrics.EndTask(start);
+        }
+        batch.clear();
+    }
+
+    /**
+     * @brief 按通道策略弹出一批任务
+     *
+     * @details 单通道时直接 TryPopBulk；多通道时由 cursor 选择通道（见 ExecutorLanes）
+     *
+     * @return 放入 batch 的任务数
+     */
+    size_t PopLanes(LaneCursor& cursor, std::vector<T>& batch) {
+        if (_lanes.empty())
+            return _queue.TryPopBulk(std::back_inserter(batch), kBatchSize);
+
+        return cursor.Next(_lanes.size() + 1, [&](size_t lane, size_t limit) {
+            LockFreeQueue& queue = lane == 0 ? _queue : *_lanes[lane - 1];
+            return queue.TryPopBulk(std::back_inserter(batch), limit < kBatchSize ? limit : kBatchSize);
+        });
+    }
+
+    /**
+     * @brief 通道编号 → 队列（通道 0 为构造时传入的 queue）
+     */
+    LockFreeQueue& Lane(size_t lane) {
+        return lane == 0 ? _queue : *_lanes[lane - 1];
+    }
+
+    /**
+     * @brief 超出范围的通道编号归入优先级最低的通道
+     */
+    size_t ClampLane(size_t lane) const {
+        return lane <= _lanes.size() ? lane : _lanes.size();
+    }
+
+    /**
+     * @brief 单次提交尝试：入队并唤醒一个停车的工作线程
+     * @details 运行检查与入队之间登记在 _inFlight 中（见 InFlightGuard）
+     * @return Runtime 未运行时为 Full；仅 Ok 时消耗 task
+     */
+    template<typename U>
+    RingQueueResult Offer(U&& task, size_t lane) {
+        InFlightGuard guard(_inFlight);
+        if (!_running.load(std::memory_order_seq_cst))
+            return RingQueueResult::Full;
+
+        RingQueueResult r;
+        while ((r = Lane(lane).TryPush(std::forward<U>(task))) == RingQueueResult::Busy) {
+            _metrics.AddRejected(r);
+            CpuRelax();
+        }
+        if (r != RingQueueResult::Ok) {
+            _metrics.AddRejected(r);
+            return r;
+        }
+        _metrics.AddSubmitted();
+        _parking.NotifyOne();
+        return RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 等待空位直到入队（见 Submit）
+     */
+    template<typename U>
+    bool SubmitUntil(U&& task) {
+        if (_tlsOwner == this) {
+            if (Offer(std::forward<U>(task), 0) != RingQueueResult::Ok)
+                _callback(task);
+            return true;
+        }
+        return SubmitWithBackpressure(
+            _space,
+            [&] { return Offer(std::forward<U>(task), 0); },
+            [&] { return _running.load(std::memory_order_acquire); });
+    }
+
+    /**
+     * @brief 停车前的再检查：就绪队列或任一通道非空
+     */
+    bool HasWork() const {
+        if (_ready.SizeApprox() > 0 || _queue.SizeApprox() > 0)
+            return true;
+        for (const LockFreeQueue* lane : _lanes) {
+            if (lane->SizeApprox() > 0)
+                return true;
+        }
+        return false;
+    }
+
     /**
      * @brief 工作线程主函数
      *
      * 行为：
      * - 创建本线程的协程集合
-     * - 轮询恢复协程
-     * - 无进展时执行 Backoff
+     * - 恢复就绪队列中被 Schedule() 挂起的协程（每轮最多 kBatchSize 个）
+     * - TryPopBulk 取到任务时轮转恢复一个协程执行整批任务
+     *   （每批最多 kBatchSize 个，只消耗一次 CAS）
+     * - 两者都为空时计为一次空轮询：连续 kParkAfter 次以内执行 Backoff，
+     *   之后再检查所有队列仍为空则在 EventCount 上停车，直到提交 / Schedule() / Notify() / Stop() 唤醒
+     *
+     * @param index 工作线程编号（对应调度计数器）
      */
-    void ThreadMain() {
+    void ThreadMain(size_t index) {
+        ApplyThreadConfig(_threadConfig, index);
+        _tlsOwner = this;
+        SchedulerCounters& counters = _counters[index];
+        WorkerMetrics& metrics = _metrics.Worker(index);
+        LaneCursor cursor(_laneWeights);
+
+        std::vector<T> batch;
+        batch.reserve(kBatchSize);
+
         std::vector<WorkerTask> tasks;
         tasks.reserve(_coroutinePerThread);
 
         for (size_t i = 0; i < _coroutinePerThread; ++i) {
-            tasks.emplace_back(CoroutineLoop());
+            tasks.emplace_back(CoroutineLoop(batch, metrics));
         }
 
         BackoffPolicy backoff;
         size_t missCount = 0;
+        size_t next = 0;
 
         while (_running.load(std::memory_order_relaxed)) {
             bool progressed = false;
 
-            for (auto& task : tasks) {
-                if (task.handle && !task.handle.done()) {
-                    task.handle.resume();
-                    progressed = true;
+            // 每轮最多恢复 kBatchSize 个就绪协程：反复 co_await Schedule() 的协程会在本轮内
+            // 重新入队，不设上限会让工作线程永远停在这里，既饿死任务队列也无法响应 Stop()
+            std::coroutine_handle<> ready;
+            for (size_t i = 0; i < kBatchSize && _running.load(std::memory_order_relaxed); ++i) {
+                if (_ready.TryPop(ready) != RingQueueResult::Ok) break;
+                ready.resume();
+                counters.AddResume();
+                progressed = true;
+            }
+
+            if (PopLanes(cursor, batch) > 0) {
+                _space.NotifyAll();
+                if (tasks.empty()) {
+                    RunBatch(batch, metrics);
+                } else {
+                    tasks[next].handle.resume();
+                    next = (next + 1) % tasks.size();
+                    counters.AddResume();
                 }
+                progressed = true;
             }
 
             if (!progressed) {
-                ++missCount;
-                backoff(missCount);
+                counters.AddEmptyPoll();
+                if (++missCount < kParkAfter) {
+                    backoff(missCount);
+                    continue;
+                }
+                auto key = _parking.PrepareWait();
+                if (HasWork() || !_running.load(std::memory_order_acquire)) {
+                    _parking.CancelWait();
+                    continue;
+                }
+                metrics.AddPark();
+                _parking.Wait(key);
             } else {
                 missCount = 0;
             }
         }
 
+        // batch 为空：恢复后协程直接走到 final_suspend
         for (auto& task : tasks) {
+            if (task.handle && !task.handle.done())
+                task.handle.resume();
             if (task.handle)
                 task.handle.destroy();
         }
     }
 
 private:
-    LockFreeQueue& _queue;           ///< 外部无锁任务队列
+    static constexpr size_t kBatchSize = 16; ///< 每次弹出的最大任务数
+    static constexpr size_t kParkAfter = 200; ///< 连续空轮询达到该次数后停车
+
+    static inline thread_local CoroutineExecutorMT* _tlsOwner = nullptr; ///< 当前线程所属的 Runtime（工作线程）
+
+    LockFreeQueue& _queue;           ///< 外部无锁任务队列（通道 0）
+    std::vector<LockFreeQueue*> _lanes; ///< 低优先级通道 1..N-1（外部队列）
+    std::vector<uint32_t> _laneWeights; ///< 各通道每轮的取出份额（空为严格优先级）
     Callback _callback;              ///< 任务执行回调
 
     std::atomic<bool> _running;      ///< 运行状态
@@ -212,7 +559,14 @@ private:
     size_t _coroutinePerThread;      ///< 每线程协程数量
 
     std::vector<std::thread> _threads;
+    ThreadConfig _threadConfig;      ///< 工作线程放置与命名
+
+    RingQueue<std::coroutine_handle<>> _ready; ///< 被 Schedule() 挂起、等待恢复的协程
+    EventCount _parking; ///< 空闲工作线程停车 / 唤醒
+    EventCount _space;   ///< 等待队列空位的生产者停车 / 唤醒（Submit）
+    alignas(kCacheLineSize) std::atomic<size_t> _inFlight{0}; ///< 已通过运行检查、尚未完成入队的提交数
+
+    std::unique_ptr<SchedulerCounters[]> _counters; ///< 每工作线程一份调度计数
 
-    std::condition_variable _cv;
-    std::mutex _mutex;
+    ExecutorMetrics _metrics; ///< 运行指标（EXECUTOR_METRICS 关闭时为空实现）
 };
@@ -1,28 +1,54 @@
 #pragma once
 
-#include <Executor/ResultTask.h>
+#include <functional>
+#include <Executor/Future.h>
 #include <Executor/CoroutineExecutor.h>
 
 /**
  * @class CoroutineExecutorResult
  * @brief 基于 CoroutineExecutor 的返回结果提交语义
  *
+ * @details
+ * - SubmitAsync() 不等待任务执行，立即返回 Future<R>（队列满时先等待空位）
+ * - Future::Then() 的续体同样投递到该 CoroutineExecutor 上执行
+ * - Submit() 为阻塞版本：队列满时等待空位（CoroutineExecutor::Submit），执行完成后返回结果
+ *
  * @tparam R 返回值类型
+ * @tparam Task CoroutineExecutor 的任务类型，需可由 std::function<void()> 构造
  *
  * @author BUG
  */
-template<typename R>
+template<typename R, typename Task = std::function<void()>>
 class CoroutineExecutorResult {
 public:
-    explicit CoroutineExecutorResult(CoroutineExecutor& exec)
+    explicit CoroutineExecutorResult(CoroutineExecutor<Task>& exec)
         : _exec(exec) {}
 
+    /**
+     * @brief 提交并立即返回结果 Future（不等待任务执行）
+     * @details 语义见 CoroutineExecutor::SubmitAsync
+     * @return 总是 Valid() 的 Future
+     */
+    Future<R> SubmitAsync(std::function<R()> fn) {
+        return _exec.template SubmitAsync<std::function<R()>, R>(std::move(fn));
+    }
+
+    /**
+     * @brief 阻塞提交，直到取得结果
+     * @note 不可在该 CoroutineExecutor 的调度线程内调用，否则会自锁
+     */
     R Submit(std::function<R()> fn) {
-        ResultTask<R> task(std::move(fn));
-        _exec.Add(std::ref(task));
-        return task.Get();
+        auto [promise, future] = MakePromise<R>(FutureExecutor::From(_exec));
+        Task task{std::function<void()>(
+            [p = std::move(promise), fn = std::move(fn)]() mutable {
+                p.SetValueFrom(fn);
+            })};
+        // 队列满时在 Submit 内等待空位；Runtime 未运行时 Submit 拒绝，在调用线程执行
+        if (!_exec.Submit(std::move(task)))
+            task();
+        return future.Get();
     }
 
 private:
-    CoroutineExecutor& _exec;
+    CoroutineExecutor<Task>& _exec;
 };
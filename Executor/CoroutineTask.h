@@ -0,0 +1,216 @@
+#pragma once
+
+#include <coroutine>
+#include <optional>
+#include <utility>
+#include <exception>
+#include <type_traits>
+#include <Executor/Future.h>
+
+/**
+ * @class CoTask
+ * @brief 惰性启动、可 co_await 的协程任务
+ *
+ * @details
+ * 【执行模型】
+ * - 创建后不执行（initial_suspend = suspend_always），直到被 co_await
+ * - co_await 时通过对称转移（symmetric transfer）直接切换到子协程，
+ *   子协程结束时再对称转移回等待者，不增加调用栈深度
+ * - 切换到线程池由 co_await exec.Schedule() 完成，
+ *   被挂起的句柄投递到 Runtime 的 RingQueue，不会被轮询
+ *
+ * 【所有权】
+ * - CoTask 独占协程帧，析构时销毁
+ * - 顶层任务通过 Spawn()（分离执行）或 SyncWait()（阻塞取结果）启动
+ *
+ * @code
+ *   CoTask<int> Compute(CoroutineExecutor<Fn>& exec) {
+ *       co_await exec.Schedule();                // 切换到 Runtime 线程
+ *       int v = co_await exec.SubmitAsync(fn);   // 挂起直到结果就绪
+ *       co_return v + 1;
+ *   }
+ *   int r = SyncWait(Compute(exec));
+ * @endcode
+ *
+ * @tparam T 结果类型
+ * @author BUG
+ * @date 2025-12-22
+ */
+template<typename T = void>
+class CoTask;
+
+/**
+ * @brief CoTask promise 的公共部分
+ */
+class CoTaskPromiseBase {
+public:
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept {
+            auto continuation = h.promise()._continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() { std::terminate(); }
+
+    std::coroutine_handle<> _continuation; ///< 结束后要恢复的等待者
+};
+
+template<typename T>
+class CoTaskPromise : public CoTaskPromiseBase {
+public:
+    CoTask<T> get_return_object() noexcept;
+
+    template<typename U>
+    void return_value(U&& value) {
+        _value.emplace(std::forward<U>(value));
+    }
+
+    T TakeResult() {
+        return std::move(*_value);
+    }
+
+private:
+    std::optional<T> _value;
+};
+
+template<>
+class CoTaskPromise<void> : public CoTaskPromiseBase {
+public:
+    CoTask<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+    void TakeResult() noexcept {}
+};
+
+template<typename T>
+class CoTask {
+public:
+    using promise_type = CoTaskPromise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    CoTask() = default;
+
+    explicit CoTask(Handle h)
+        : _handle(h) {}
+
+    CoTask(CoTask&& other) noexcept
+        : _handle(std::exchange(other._handle, nullptr)) {}
+
+    CoTask& operator=(CoTask&& other) noexcept {
+        if (this != &other) {
+            if (_handle) _handle.destroy();
+            _handle = std::exchange(other._handle, nullptr);
+        }
+        return *this;
+    }
+
+    CoTask(const CoTask&) = delete;
+    CoTask& operator=(const CoTask&) = delete;
+
+    ~CoTask() {
+        if (_handle) _handle.destroy();
+    }
+
+    bool Valid() const { return static_cast<bool>(_handle); }
+    bool Done() const { return _handle && _handle.done(); }
+
+    /**
+     * @brief 等待子任务完成（对称转移）
+     */
+    auto operator co_await() noexcept {
+        struct Awaiter {
+            Handle handle;
+
+            bool await_ready() noexcept {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise()._continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() {
+                return handle.promise().TakeResult();
+            }
+        };
+        return Awaiter{_handle};
+    }
+
+private:
+    Handle _handle;
+};
+
+template<typename T>
+CoTask<T> CoTaskPromise<T>::get_return_object() noexcept {
+    return CoTask<T>(std::coroutine_handle<CoTaskPromise<T>>::from_promise(*this));
+}
+
+inline CoTask<void> CoTaskPromise<void>::get_return_object() noexcept {
+    return CoTask<void>(std::coroutine_handle<CoTaskPromise<void>>::from_promise(*this));
+}
+
+/**
+ * @brief 立即启动、结束后自行销毁的协程（顶层驱动器）
+ */
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+/**
+ * @brief 分离启动一个顶层任务
+ *
+ * @details
+ * 任务在调用线程上运行到第一个挂起点（通常是 co_await exec.Schedule()），
+ * 之后由 Runtime 驱动；任务结束时协程帧自动释放
+ */
+inline DetachedCoroutine Spawn(CoTask<void> task) {
+    co_await task;
+}
+
+/**
+ * @brief 驱动 task 并把结果写入 promise
+ */
+template<typename T>
+DetachedCoroutine CoTaskToPromise(CoTask<T> task, Promise<T> promise) {
+    if constexpr (std::is_void_v<T>) {
+        co_await task;
+        promise.SetValue();
+    } else {
+        promise.SetValue(co_await task);
+    }
+}
+
+/**
+ * @brief 启动任务并返回其结果的 Future
+ * @details 结果就绪后 Future 的续体在完成任务的线程上直接执行
+ */
+template<typename T>
+Future<T> StartAsFuture(CoTask<T> task) {
+    auto [promise, future] = MakePromise<T>();
+    CoTaskToPromise<T>(std::move(task), std::move(promise));
+    return std::move(future);
+}
+
+/**
+ * @brief 在当前线程阻塞等待任务完成并返回结果
+ * @note 不可在驱动该任务的 Runtime 线程上调用，否则会自锁
+ */
+template<typename T>
+T SyncWait(CoTask<T> task) {
+    return StartAsFuture<T>(std::move(task)).Get();
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <climits>
+#include <chrono>
+
+#ifdef __linux__
+#include <ctime>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#else
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief CPU 自旋提示
+ * @details 在自旋等待中降低功耗并让出超线程资源，不会让出 OS 时间片
+ */
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @class EventCount
+ * @brief 无锁队列配套的线程停车（park）/ 唤醒原语
+ *
+ * @details
+ * 【设计定位】
+ * EventCount 让消费者在「队列为空」这一条件上睡眠，而不需要互斥锁保护队列本身。
+ * 它只负责 wait / notify，不关心条件是什么。
+ *
+ * 【使用协议】
+ * 消费者：
+ * @code
+ *   auto key = ec.PrepareWait();     // 1. 登记为等待者
+ *   if (TryPop(task)) {              // 2. 再检查一次条件
+ *       ec.CancelWait();             //    条件已满足：撤销登记
+ *   } else {
+ *       ec.Wait(key);                // 3. 条件不满足：睡眠
+ *   }
+ * @endcode
+ *
+ * 生产者：
+ * @code
+ *   Push(task);
+ *   ec.NotifyOne();                  // 无等待者时仅一次 fence + load
+ * @endcode
+ *
+ * 【正确性】
+ * PrepareWait 与 Notify 之间以 seq_cst 建立 Dekker 式的顺序：
+ * - 要么生产者看到等待者并推进 epoch（Wait 立即返回或被唤醒）
+ * - 要么消费者在第 2 步的再检查中看到新任务
+ * 因此不会丢失唤醒，也不需要超时轮询。
+ *
+ * 【实现】
+ * - Linux：epoch 直接作为 futex 字，Wait / Notify 各至多一次系统调用
+ * - 其他平台：回退到 mutex + condition_variable，仅在存在等待者时加锁
+ *
+ * @author BUG
+ * @date 2025-12-22
+ */
+class EventCount {
+public:
+    using Key = uint32_t;
+
+    EventCount() = default;
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    /**
+     * @brief 登记为等待者
+     * @return 当前 epoch，传给 Wait()
+     * @note 之后必须调用 Wait() 或 CancelWait() 之一
+     */
+    Key PrepareWait() {
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        // 与 Notify 中的 fence 配对：保证之后对队列的再检查不会早于登记
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return _epoch.load(std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief 撤销等待登记（再检查时条件已满足）
+     */
+    void CancelWait() {
+        _waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief 睡眠直到 epoch 相对 key 发生变化
+     * @param key PrepareWait() 的返回值
+     */
+    void Wait(Key key) {
+        while (_epoch.load(std::memory_order_acquire) == key) {
+#ifdef __linux__
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch),
+                    FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+#else
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [&] {
+                return _epoch.load(std::memory_order_acquire) != key;
+            });
+#endif
+        }
+        _waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief 睡眠直到 epoch 相对 key 发生变化或超时
+     * @param key PrepareWait() 的返回值
+     * @param timeout 最长等待时间
+     * @return true 被唤醒，false 超时
+     */
+    template<typename Rep, typename Period>
+    bool WaitFor(Key key, std::chrono::duration<Rep, Period> timeout) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        bool woken = true;
+        while (_epoch.load(std::memory_order_acquire) == key) {
+            auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= remaining.zero()) {
+                woken = false;
+                break;
+            }
+#ifdef __linux__
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+            ts.tv_nsec = static_cast<long>(ns % 1000000000);
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch),
+                    FUTEX_WAIT_PRIVATE, key, &ts, nullptr, 0);
+#else
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait_until(lock, deadline, [&] {
+                return _epoch.load(std::memory_order_acquire) != key;
+            });
+#endif
+        }
+        _waiters.fetch_sub(1, std::memory_order_seq_cst);
+        return woken;
+    }
+
+    /**
+     * @brief 唤醒一个等待者
+     * @details 没有等待者时不进行任何系统调用
+     */
+    void NotifyOne() {
+        Notify(1);
+    }
+
+    /**
+     * @brief 唤醒所有等待者
+     */
+    void NotifyAll() {
+        Notify(INT_MAX);
+    }
+
+    /**
+     * @brief 获取当前等待者数量（近似值）
+     * @note 仅用于监控 / 调试
+     */
+    uint32_t WaitersApprox() const {
+        return _waiters.load(std::memory_order_relaxed);
+    }
+
+private:
+    void Notify(int count) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_relaxed) == 0)
+            return;
+
+#ifdef __linux__
+        _epoch.fetch_add(1, std::memory_order_seq_cst);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch),
+                FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _epoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+        if (count == 1) {
+            _cv.notify_one();
+        } else {
+            _cv.notify_all();
+        }
+#endif
+    }
+
+    std::atomic<uint32_t> _epoch{0};   ///< 每次有效通知递增（futex 字）
+    std::atomic<uint32_t> _waiters{0}; ///< 已登记的等待者数量
+
+#ifndef __linux__
+    std::mutex _mutex;
+    std::condition_variable _cv;
+#endif
+};
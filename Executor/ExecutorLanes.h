@@ -0,0 +1,137 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief ThreadExecutor 的优先级通道配置
+ *
+ * @details
+ * - 通道 0 是构造时传入的 LockFreeExecutor（最高优先级，Submit / TrySubmit 的默认通道），
+ *   WorkStealing 模式下的本地队列 / 收件箱也属于通道 0
+ * - 通道 1..count-1 由 Runtime 内部创建，容量为 capacity，编号越大优先级越低
+ * - weights 为空：严格优先级，只有编号更小的通道全部为空时才取下一个通道，
+ *   低优先级通道每次只取一个任务，保证高优先级任务最多等待一个低优先级任务
+ * - weights 非空：加权轮转（drain ratio），每轮通道 i 最多连续取 weights[i] 个任务，
+ *   空通道让出剩余份额；未给出或为 0 的权重按 1 处理，任何通道都不会饿死
+ *
+ * 默认值（count = 1）与单队列行为完全相同，不产生额外开销。
+ */
+struct ExecutorLanes {
+    size_t count = 1;               ///< 通道总数（含通道 0）
+    size_t capacity = 1024;         ///< 内部通道（1..count-1）的容量
+    std::vector<uint32_t> weights;  ///< 各通道每轮的取出份额，空表示严格优先级
+};
+
+/**
+ * @brief 工作线程私有的通道选择游标
+ *
+ * @details
+ * 每个工作线程一份，只由所属线程访问，无需同步。
+ * Next() 按 ExecutorLanes 描述的策略依次调用 take(lane, limit)：
+ * - take 从 lane 中最多取 limit 个任务，返回实际取到的数量（0 表示空 / 竞争失败）
+ * - 返回值为本次取到的任务数，0 表示所有通道都没有取到
+ */
+class LaneCursor {
+public:
+    static constexpr size_t kUnlimited = std::numeric_limits<size_t>::max();
+
+    explicit LaneCursor(std::vector<uint32_t> weights)
+        : _weights(std::move(weights)), _credit(Weight(0)) {}
+
+    template<typename Take>
+    size_t Next(size_t laneCount, Take&& take) {
+        if (_weights.empty()) {
+            for (size_t lane = 0; lane < laneCount; ++lane) {
+                size_t n = take(lane, lane == 0 ? kUnlimited : 1);
+                if (n > 0) return n;
+            }
+            return 0;
+        }
+
+        for (size_t tried = 0; tried < laneCount; ++tried) {
+            size_t n = take(_lane, _credit);
+            if (n > 0) {
+                _credit -= n < _credit ? n : _credit;
+                if (_credit == 0) Advance(laneCount);
+                return n;
+            }
+            Advance(laneCount);
+        }
+        return 0;
+    }
+
+private:
+    void Advance(size_t laneCount) {
+        _lane = (_lane + 1) % laneCount;
+        _credit = Weight(_lane);
+    }
+
+    size_t Weight(size_t lane) const {
+        return lane < _weights.size() && _weights[lane] > 0 ? _weights[lane] : 1;
+    }
+
+    std::vector<uint32_t> _weights;
+    size_t _lane = 0;   ///< 当前轮到的通道
+    size_t _credit = 1; ///< 当前通道本轮剩余份额
+};
+
+/**
+ * @brief 任务是否携带截止时间（Deadline() 返回 steady_clock::time_point）
+ */
+template<typename T, typename = void>
+struct HasDeadline : std::false_type {};
+
+template<typename T>
+struct HasDeadline<T, std::void_t<decltype(std::declval<const T&>().Deadline())>>
+    : std::is_convertible<decltype(std::declval<const T&>().Deadline()),
+                          std::chrono::steady_clock::time_point> {};
+
+/**
+ * @brief 任务出队后是否已过期、应被丢弃（shed）而不执行
+ * @details 不带截止时间的任务类型恒为 false，编译期消除，不读时钟
+ */
+template<typename Task>
+inline bool TaskExpired(const Task& task) {
+    if constexpr (HasDeadline<Task>::value) {
+        return std::chrono::steady_clock::now() >= task.Deadline();
+    } else {
+        return false;
+    }
+}
+
+/**
+ * @brief 携带截止时间的任务包装
+ *
+ * @details
+ * - 出队时已超过 deadline 的任务不会执行，直接析构（计入指标 shed）；
+ *   需要通知调用方时，由被包装对象的析构处理（如 std::packaged_task 或 Promise 的 broken_promise）
+ * - 默认 deadline 为 time_point::max()，即永不过期
+ * - operator() 转发给被包装的可调用对象
+ *
+ * @tparam F 任务类型（如 std::function<void()>）或任意数据类型
+ */
+template<typename F>
+struct DeadlineTask {
+    F task;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+    DeadlineTask() = default;
+
+    template<typename U, typename = std::enable_if_t<!std::is_same_v<std::decay_t<U>, DeadlineTask>>>
+    DeadlineTask(U&& value) : task(std::forward<U>(value)) {}
+
+    template<typename U>
+    DeadlineTask(U&& value, std::chrono::steady_clock::time_point at)
+        : task(std::forward<U>(value)), deadline(at) {}
+
+    std::chrono::steady_clock::time_point Deadline() const { return deadline; }
+
+    decltype(auto) operator()() { return task(); }
+    decltype(auto) operator()() const { return task(); }
+};
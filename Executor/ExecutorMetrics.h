@@ -0,0 +1,342 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <Containers/RingQueue.h>
+
+/**
+ * @brief 指标使用的单调时钟（纳秒）
+ */
+inline uint64_t MetricsNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief 直方图快照（普通整数，可合并、求分位数）
+ *
+ * @details
+ * 对数-线性分桶（HDR 风格）：小于 8 的值各占一个桶，之后每个 2 的幂区间再均分 8 个子桶，
+ * 相对误差 ≤ 1/8，覆盖整个 uint64_t 范围。
+ */
+struct MetricsHistogramSnapshot {
+    static constexpr size_t kSubBits = 3;
+    static constexpr size_t kSubBuckets = size_t(1) << kSubBits;
+    static constexpr size_t kBuckets = 64 * kSubBuckets;
+
+    std::array<uint64_t, kBuckets> buckets{};
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+
+    void Merge(const MetricsHistogramSnapshot& other) {
+        for (size_t i = 0; i < kBuckets; ++i) buckets[i] += other.buckets[i];
+        count += other.count;
+        sum += other.sum;
+        if (other.max > max) max = other.max;
+    }
+
+    double Mean() const {
+        return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief 分位数（返回所在桶的上界，不超过 max）
+     * @param q 0 ~ 1
+     */
+    uint64_t Percentile(double q) const {
+        if (count == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(count - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) return UpperBound(i) < max ? UpperBound(i) : max;
+        }
+        return max;
+    }
+
+    static size_t Index(uint64_t value) {
+        if (value < kSubBuckets) return static_cast<size_t>(value);
+        size_t msb = 63 - static_cast<size_t>(__builtin_clzll(value));
+        size_t sub = static_cast<size_t>(value >> (msb - kSubBits)) & (kSubBuckets - 1);
+        return (msb - kSubBits + 1) * kSubBuckets + sub;
+    }
+
+    static uint64_t UpperBound(size_t index) {
+        if (index < kSubBuckets) return index;
+        size_t shift = index / kSubBuckets - 1;
+        uint64_t base = (kSubBuckets + index % kSubBuckets) << shift;
+        return base + ((uint64_t(1) << shift) - 1);
+    }
+};
+
+/**
+ * @brief 单写者直方图
+ *
+ * @details
+ * - 只由所属工作线程写入（relaxed load + store，无 RMW），与 SchedulerCounters 相同
+ * - 读取方在任意线程 AccumulateTo，得到近似一致的快照
+ */
+class MetricsHistogram {
+public:
+    void Record(uint64_t value) {
+        Bump(_buckets[MetricsHistogramSnapshot::Index(value)], 1);
+        Bump(_count, 1);
+        Bump(_sum, value);
+        if (value > _max.load(std::memory_order_relaxed))
+            _max.store(value, std::memory_order_relaxed);
+    }
+
+    void AccumulateTo(MetricsHistogramSnapshot& snapshot) const {
+        MetricsHistogramSnapshot mine;
+        for (size_t i = 0; i < MetricsHistogramSnapshot::kBuckets; ++i)
+            mine.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+        mine.count = _count.load(std::memory_order_relaxed);
+        mine.sum = _sum.load(std::memory_order_relaxed);
+        mine.max = _max.load(std::memory_order_relaxed);
+        snapshot.Merge(mine);
+    }
+
+private:
+    static void Bump(std::atomic<uint64_t>& v, uint64_t n) {
+        v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, MetricsHistogramSnapshot::kBuckets> _buckets{};
+    std::atomic<uint64_t> _count{0};
+    std::atomic<uint64_t> _sum{0};
+    std::atomic<uint64_t> _max{0};
+};
+
+/**
+ * @brief Executor / Consumer 指标快照
+ *
+ * @details
+ * - submitted     成功提交的任务数
+ * - rejectedFull  因队列已满被拒绝的提交次数
+ * - rejectedBusy  提交时竞争失败（Busy / CAS 失败）的次数，含内部重试
+ * - executed      已执行完的任务数
+ * - shed          出队时已超过截止时间、未执行即丢弃的任务数（见 DeadlineTask）
+ * - steals        从其他工作线程窃取到任务的次数（仅 WorkStealing）
+ * - parks         工作线程进入睡眠 / 退避的次数
+ * - queueDepth    取快照时共享队列中的任务数（近似值）
+ * - wait          入队到开始执行的耗时（ns），只统计带入队时间戳的任务（见 TimedTask）
+ * - run           单个任务的执行耗时（ns）
+ */
+struct ExecutorStats {
+    size_t submitted = 0;
+    size_t rejectedFull = 0;
+    size_t rejectedBusy = 0;
+    size_t executed = 0;
+    size_t shed = 0;
+    size_t steals = 0;
+    size_t parks = 0;
+    size_t queueDepth = 0;
+    MetricsHistogramSnapshot wait;
+    MetricsHistogramSnapshot run;
+};
+
+/**
+ * @brief 任务是否携带入队时间戳（EnqueueTime() / SetEnqueueTime(uint64_t)）
+ */
+template<typename T, typename = void>
+struct HasEnqueueTime : std::false_type {};
+
+template<typename T>
+struct HasEnqueueTime<T, std::void_t<
+    decltype(std::declval<const T&>().EnqueueTime()),
+    decltype(std::declval<T&>().SetEnqueueTime(uint64_t{}))>> : std::true_type {};
+
+/**
+ * @brief 记录入队时间戳
+ * @details 仅在指标打开且任务类型支持时写入，否则为空操作
+ */
+template<typename Task>
+inline void MetricsStampEnqueue(Task& task) {
+    if constexpr (kMetricsEnabled && HasEnqueueTime<Task>::value) {
+        task.SetEnqueueTime(MetricsNowNs());
+    }
+}
+
+/**
+ * @brief 携带入队时间戳的任务包装
+ *
+ * @details
+ * - 构造时（指标打开）记录当前时间；ThreadExecutor::Submit / ThreadConsumer::AddTask
+ *   会在入队前重新打戳
+ * - 直接推入外部队列的 Runtime（CoroutineExecutorMT）以构造时间为入队时间
+ * - operator() 转发给被包装的可调用对象
+ *
+ * @tparam F 任务类型（如 std::function<void()>）或任意数据类型
+ */
+template<typename F>
+struct TimedTask {
+    F task;
+    uint64_t enqueueNs = 0;
+
+    TimedTask() = default;
+
+    template<typename U, typename = std::enable_if_t<!std::is_same_v<std::decay_t<U>, TimedTask>>>
+    TimedTask(U&& value) : task(std::forward<U>(value)) {
+        if constexpr (kMetricsEnabled) enqueueNs = MetricsNowNs();
+    }
+
+    uint64_t EnqueueTime() const { return enqueueNs; }
+    void SetEnqueueTime(uint64_t ns) { enqueueNs = ns; }
+
+    decltype(auto) operator()() { return task(); }
+};
+
+/**
+ * @brief 单个工作线程的指标分片（EXECUTOR_METRICS 打开时）
+ *
+ * @details
+ * - 只由所属工作线程写入（relaxed load + store，无 RMW）
+ * - 独占 cache line，读取方聚合时不干扰热路径
+ * - 计时方式：start = Now(); BeginTask(task, start); 执行; start = EndTask(start)
+ */
+struct alignas(kCacheLineSize) WorkerMetricsShard {
+    std::atomic<size_t> executed{0};
+    std::atomic<size_t> shed{0};
+    std::atomic<size_t> steals{0};
+    std::atomic<size_t> parks{0};
+    MetricsHistogram wait;
+    MetricsHistogram run;
+
+    static uint64_t Now() { return MetricsNowNs(); }
+
+    void AddShed() { Bump(shed); }
+    void AddSteal() { Bump(steals); }
+    void AddPark() { Bump(parks); }
+
+    /// 记录入队到开始执行（start）的等待时间，仅带时间戳的任务
+    template<typename Task>
+    void BeginTask(const Task& task, uint64_t start) {
+        if constexpr (HasEnqueueTime<Task>::value) {
+            uint64_t enqueued = task.EnqueueTime();
+            if (enqueued != 0) wait.Record(start > enqueued ? start - enqueued : 0);
+        }
+    }
+
+    /// 记录一次执行完成，返回结束时间（批量执行时作为下一个任务的开始时间，每任务只读一次时钟）
+    uint64_t EndTask(uint64_t start) {
+        uint64_t end = Now();
+        run.Record(end - start);
+        Bump(executed);
+        return end;
+    }
+
+    void AccumulateTo(ExecutorStats& stats) const {
+        stats.executed += executed.load(std::memory_order_relaxed);
+        stats.shed += shed.load(std::memory_order_relaxed);
+        stats.steals += steals.load(std::memory_order_relaxed);
+        stats.parks += parks.load(std::memory_order_relaxed);
+        wait.AccumulateTo(stats.wait);
+        run.AccumulateTo(stats.run);
+    }
+
+private:
+    static void Bump(std::atomic<size_t>& v) {
+        v.store(v.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief 指标关闭时的工作线程空分片
+ */
+struct NullWorkerMetricsShard {
+    static uint64_t Now() { return 0; }
+    void AddShed() {}
+    void AddSteal() {}
+    void AddPark() {}
+    template<typename Task>
+    void BeginTask(const Task&, uint64_t) {}
+    uint64_t EndTask(uint64_t) { return 0; }
+    void AccumulateTo(ExecutorStats&) const {}
+};
+
+using WorkerMetrics = std::conditional_t<kMetricsEnabled, WorkerMetricsShard, NullWorkerMetricsShard>;
+
+/**
+ * @brief 一个 Runtime 的全部指标（EXECUTOR_METRICS 打开时）
+ *
+ * @details
+ * - 工作线程侧：每线程一个 WorkerMetricsShard，单写者
+ * - 提交侧：任意线程写入，按 MetricsStripeIndex() 分片 fetch_add（relaxed）
+ * - Snapshot() 按需聚合，不与热路径同步
+ */
+class ExecutorMetricsRegistry {
+public:
+    explicit ExecutorMetricsRegistry(size_t workerCount)
+        : _workerCount(workerCount), _workers(new WorkerMetricsShard[workerCount]) {}
+
+    WorkerMetricsShard& Worker(size_t index) { return _workers[index]; }
+
+    void AddSubmitted(size_t n = 1) {
+        Stripe().submitted.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    /// 记录一次被拒绝 / 需重试的提交：Full 与 Busy 分别计数
+    void AddRejected(RingQueueResult result) {
+        if (result == RingQueueResult::Full)
+            Stripe().rejectedFull.fetch_add(1, std::memory_order_relaxed);
+        else if (result == RingQueueResult::Busy)
+            Stripe().rejectedBusy.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ExecutorStats Snapshot(size_t queueDepth) const {
+        ExecutorStats stats;
+        for (const auto& s : _producers) {
+            stats.submitted += s.submitted.load(std::memory_order_relaxed);
+            stats.rejectedFull += s.rejectedFull.load(std::memory_order_relaxed);
+            stats.rejectedBusy += s.rejectedBusy.load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < _workerCount; ++i) {
+            _workers[i].AccumulateTo(stats);
+        }
+        stats.queueDepth = queueDepth;
+        return stats;
+    }
+
+private:
+    struct alignas(kCacheLineSize) ProducerCounters {
+        std::atomic<size_t> submitted{0};
+        std::atomic<size_t> rejectedFull{0};
+        std::atomic<size_t> rejectedBusy{0};
+    };
+
+    ProducerCounters& Stripe() { return _producers[MetricsStripeIndex()]; }
+
+    size_t _workerCount;
+    std::unique_ptr<WorkerMetricsShard[]> _workers;
+    ProducerCounters _producers[kMetricsStripes];
+};
+
+/**
+ * @brief 指标关闭时的空实现：只报告 queueDepth
+ */
+class NullExecutorMetricsRegistry {
+public:
+    explicit NullExecutorMetricsRegistry(size_t) {}
+
+    NullWorkerMetricsShard& Worker(size_t) { return _worker; }
+    void AddSubmitted(size_t = 1) {}
+    void AddRejected(RingQueueResult) {}
+
+    ExecutorStats Snapshot(size_t queueDepth) const {
+        ExecutorStats stats;
+        stats.queueDepth = queueDepth;
+        return stats;
+    }
+
+private:
+    NullWorkerMetricsShard _worker;
+};
+
+using ExecutorMetrics = std::conditional_t<kMetricsEnabled, ExecutorMetricsRegistry, NullExecutorMetricsRegistry>;
@@ -0,0 +1,461 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <new>
+#include <thread>
+#include <utility>
+#include <functional>
+#include <future>
+#include <type_traits>
+#include <Executor/EventCount.h>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+/**
+ * @brief Future 的续体投递目标
+ *
+ * @details
+ * 以「上下文指针 + 函数指针」擦除具体 Runtime 类型，
+ * 使 Future<R> 不依赖 ThreadExecutor / CoroutineExecutor 的模板参数。
+ *
+ * - post == nullptr 时续体在完成结果的线程上直接执行
+ * - post 返回 false（队列已满）时同样回退为直接执行
+ */
+struct FutureExecutor {
+    void* context = nullptr;
+    bool (*post)(void* context, std::function<void()>&& fn) = nullptr;
+
+    /**
+     * @brief 基于任意提供 TrySubmit(std::function<void()>) 的 Runtime 构造
+     * @details 续体投递不等待队列空位：队列满时由 Dispatch 回退为直接执行
+     */
+    template<typename Exec>
+    static FutureExecutor From(Exec& exec) {
+        return FutureExecutor{
+            &exec,
+            [](void* ctx, std::function<void()>&& fn) -> bool {
+                return static_cast<Exec*>(ctx)->TrySubmit(std::move(fn));
+            }
+        };
+    }
+
+    void Dispatch(std::function<void()>&& fn) const {
+        if (post && post(context, std::move(fn)))
+            return;
+        if (fn) fn();
+    }
+};
+
+/// void 结果的占位类型
+struct FutureUnit {};
+
+/**
+ * @class FutureState
+ * @brief Future / Promise 共享状态
+ *
+ * @details
+ * - 一次堆分配，结果直接存放在内联的未初始化存储中，不要求 R 可默认构造
+ * - 任务抛出的异常以 std::exception_ptr 保存，与结果一样标记为就绪，Get() 时重新抛出
+ * - 单个原子状态字驱动 Pending → (Callback) → Ready 的转换，无互斥锁
+ * - 只有调用 Get()/Wait() 的线程才会在 EventCount 上停车
+ * - 侵入式引用计数，Future 与 Promise 各持一份
+ * - 另计写入端（Promise）数量：最后一个 Promise 释放时仍未完成，
+ *   以 std::future_error(broken_promise) 完成，等待者不会永久阻塞
+ *
+ * @tparam R 结果类型（void 以 FutureUnit 存储）
+ */
+template<typename R>
+class FutureState {
+public:
+    using Stored = std::conditional_t<std::is_void_v<R>, FutureUnit, R>;
+
+    explicit FutureState(FutureExecutor exec)
+        : _exec(exec) {}
+
+    ~FutureState() {
+        if (_state.load(std::memory_order_acquire) == kReady && !_error) {
+            Value().~Stored();
+        }
+    }
+
+    void AddRef() {
+        _refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Release() {
+        if (_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    void AddWriter() {
+        _writers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 释放一个写入端；最后一个写入端释放时仍未完成则以 broken_promise 完成
+     * @details 其余写入端的 SetValue 都先于各自的释放（acq_rel），此时的 IsReady() 是确定的
+     */
+    void ReleaseWriter() {
+        if (_writers.fetch_sub(1, std::memory_order_acq_rel) == 1 && !IsReady()) {
+            SetException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        }
+    }
+
+    /**
+     * @brief 写入结果并触发续体 / 唤醒等待者
+     * @note 每个共享状态只能写入一次
+     */
+    template<typename... Args>
+    void SetValue(Args&&... args) {
+        ::new (static_cast<void*>(_storage)) Stored(std::forward<Args>(args)...);
+        Publish();
+    }
+
+    /**
+     * @brief 以异常完成（代替 SetValue）
+     * @note 每个共享状态只能写入一次
+     */
+    void SetException(std::exception_ptr error) {
+        _error = std::move(error);
+        Publish();
+    }
+
+    /**
+     * @brief 注册续体
+     * @details 结果已就绪时立即投递，否则在 SetValue 时投递
+     */
+    void SetCallback(std::function<void()>&& callback) {
+        _callback = std::move(callback);
+        uint32_t expected = kPending;
+        if (!_state.compare_exchange_strong(
+                expected, kCallback,
+                std::memory_order_acq_rel,
+                std::memory_order_acquire)) {
+            DispatchCallback();
+        }
+    }
+
+    bool IsReady() const {
+        return _state.load(std::memory_order_acquire) == kReady;
+    }
+
+    /**
+     * @brief 阻塞等待结果就绪
+     */
+    void Wait() {
+        while (!IsReady()) {
+            auto key = _waiters.PrepareWait();
+            if (IsReady()) {
+                _waiters.CancelWait();
+                break;
+            }
+            _waiters.Wait(key);
+        }
+    }
+
+    Stored& Value() {
+        return *std::launder(reinterpret_cast<Stored*>(_storage));
+    }
+
+    /// 就绪后读取：非空表示以异常完成，此时没有结果值
+    const std::exception_ptr& Error() const {
+        return _error;
+    }
+
+    const FutureExecutor& Executor() const {
+        return _exec;
+    }
+
+private:
+    /**
+     * @brief 标记就绪（发布结果 / 异常）并触发续体、唤醒等待者
+     */
+    void Publish() {
+        uint32_t prev = _state.exchange(kReady, std::memory_order_acq_rel);
+        _waiters.NotifyAll();
+        if (prev == kCallback) {
+            DispatchCallback();
+        }
+    }
+
+    /**
+     * @brief 把续体移出共享状态后投递
+     * @details 续体持有本状态的引用：留在 _callback 中会形成引用环，执行或丢弃后都必须随之析构
+     */
+    void DispatchCallback() {
+        std::function<void()> callback = std::move(_callback);
+        _callback = nullptr;
+        _exec.Dispatch(std::move(callback));
+    }
+
+    static constexpr uint32_t kPending  = 0; ///< 未完成，无续体
+    static constexpr uint32_t kCallback = 1; ///< 未完成，已注册续体
+    static constexpr uint32_t kReady    = 2; ///< 结果已就绪
+
+    std::atomic<uint32_t> _state{kPending};
+    std::atomic<uint32_t> _refs{1};
+    std::atomic<uint32_t> _writers{0}; ///< 关联的 Promise 数量
+    alignas(Stored) unsigned char _storage[sizeof(Stored)];
+    std::exception_ptr _error; ///< 任务抛出的异常（SetException）
+    std::function<void()> _callback;
+    FutureExecutor _exec;
+    EventCount _waiters;
+};
+
+/**
+ * @brief 共享状态的引用计数句柄（Future / Promise 的公共部分）
+ */
+template<typename R>
+class FutureHandle {
+public:
+    FutureHandle() = default;
+
+    explicit FutureHandle(FutureState<R>* state)
+        : _state(state) {}
+
+    FutureHandle(const FutureHandle& other)
+        : _state(other._state) {
+        if (_state) _state->AddRef();
+    }
+
+    FutureHandle(FutureHandle&& other) noexcept
+        : _state(std::exchange(other._state, nullptr)) {}
+
+    FutureHandle& operator=(FutureHandle other) noexcept {
+        std::swap(_state, other._state);
+        return *this;
+    }
+
+    ~FutureHandle() {
+        if (_state) _state->Release();
+    }
+
+    /// 是否关联了共享状态（默认构造、被 Then() 消费或被移走后无效）
+    bool Valid() const {
+        return _state != nullptr;
+    }
+
+protected:
+    FutureState<R>* _state = nullptr;
+};
+
+template<typename R>
+class Future;
+
+template<typename R>
+class Promise;
+
+/**
+ * @brief 创建一对关联的 Promise / Future
+ *
+ * @param exec 续体投递目标
+ */
+template<typename R>
+std::pair<Promise<R>, Future<R>> MakePromise(FutureExecutor exec = {});
+
+/**
+ * @class Promise
+ * @brief 结果写入端
+ *
+ * @details
+ * - 可拷贝，拷贝共享同一状态，以便放入 std::function 任务
+ * - 只能对同一状态调用一次 SetValue / SetValueFrom / SetException
+ * - 最后一个拷贝析构时仍未写入结果（任务被丢弃：Stop() 时仍在队列中、过期被丢弃等），
+ *   共享状态以 std::future_error(std::future_errc::broken_promise) 完成，Get() 时抛出
+ *
+ * @tparam R 结果类型
+ */
+template<typename R>
+class Promise : public FutureHandle<R> {
+public:
+    Promise() = default;
+
+    explicit Promise(FutureState<R>* state)
+        : FutureHandle<R>(state) {
+        if (this->_state) this->_state->AddWriter();
+    }
+
+    Promise(const Promise& other)
+        : FutureHandle<R>(other) {
+        if (this->_state) this->_state->AddWriter();
+    }
+
+    Promise(Promise&& other) noexcept = default;
+
+    Promise& operator=(Promise other) noexcept {
+        std::swap(this->_state, other._state);
+        return *this;
+    }
+
+    ~Promise() {
+        if (this->_state) this->_state->ReleaseWriter();
+    }
+
+    template<typename... Args>
+    void SetValue(Args&&... args) {
+        assert(this->Valid());
+        this->_state->SetValue(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 以异常完成 Promise，Future::Get() 时重新抛出
+     */
+    void SetException(std::exception_ptr error) {
+        assert(this->Valid());
+        this->_state->SetException(std::move(error));
+    }
+
+    /**
+     * @brief 执行 fn 并以其返回值完成 Promise
+     * @details fn 抛出的异常被捕获并保存到共享状态，不会逃出执行任务的工作线程
+     */
+    template<typename F>
+    void SetValueFrom(F& fn) {
+        assert(this->Valid());
+        try {
+            if constexpr (std::is_void_v<R>) {
+                fn();
+                this->_state->SetValue();
+            } else {
+                this->_state->SetValue(fn());
+            }
+        } catch (...) {
+            this->_state->SetException(std::current_exception());
+        }
+    }
+};
+
+/**
+ * @class Future
+ * @brief 结果读取端
+ *
+ * @details
+ * - Get() 阻塞等待并移出结果，只能调用一次；任务抛出异常时由 Get() 重新抛出
+ * - Then() 注册续体，续体在创建该 Future 的 Runtime 上执行，
+ *   并返回续体结果的 Future，可继续链式调用
+ * - 调用 Get() 或 Then() 后原 Future 的结果即被消费
+ * - 异常沿 Then() 链传递：前驱以异常完成时不调用续体，续体返回的 Future 以同一异常完成；
+ *   续体任务被丢弃而未执行时，续体返回的 Future 以 broken_promise 完成
+ * - 以下成员都要求 Valid()
+ * - 支持 C++20 协程时可直接 co_await，等待者在该 Runtime 上被恢复
+ *
+ * @tparam R 结果类型
+ */
+template<typename R>
+class Future : public FutureHandle<R> {
+public:
+    using FutureHandle<R>::FutureHandle;
+
+    bool IsReady() const {
+        assert(this->Valid());
+        return this->_state->IsReady();
+    }
+
+    void Wait() const {
+        assert(this->Valid());
+        this->_state->Wait();
+    }
+
+    R Get() {
+        assert(this->Valid());
+        this->_state->Wait();
+        if (this->_state->Error()) {
+            std::rethrow_exception(this->_state->Error());
+        }
+        if constexpr (!std::is_void_v<R>) {
+            return std::move(this->_state->Value());
+        }
+    }
+
+    /**
+     * @brief 注册续体
+     *
+     * @param fn 以 R（void 时无参数）调用的续体
+     * @return 续体结果的 Future
+     */
+    template<typename F>
+    auto Then(F&& fn) {
+        using U = typename ContinuationResult<F>::type;
+
+        assert(this->Valid());
+        FutureState<R>* self = this->_state;
+        auto [promise, future] = MakePromise<U>(self->Executor());
+
+        // 续体接管本 Future 的引用（原句柄随之失效）并持有续体结果的 Promise：
+        // 续体未执行就被析构时，续体结果以 broken_promise 完成
+        std::function<void()> callback =
+            [parent = Future(std::move(*this)), next = std::move(promise), fn = std::forward<F>(fn)]() mutable {
+                FutureState<R>* state = parent._state;
+                if (state->Error()) {
+                    next.SetException(state->Error());
+                    return;
+                }
+                try {
+                    if constexpr (std::is_void_v<R>) {
+                        if constexpr (std::is_void_v<U>) { fn(); next.SetValue(); }
+                        else { next.SetValue(fn()); }
+                    } else {
+                        if constexpr (std::is_void_v<U>) { fn(std::move(state->Value())); next.SetValue(); }
+                        else { next.SetValue(fn(std::move(state->Value()))); }
+                    }
+                } catch (...) {
+                    next.SetException(std::current_exception());
+                }
+            };
+
+        self->SetCallback(std::move(callback));
+        return std::move(future);
+    }
+
+#if defined(__cpp_impl_coroutine)
+    /**
+     * @brief 挂起当前协程直到结果就绪
+     *
+     * @details
+     * 恢复动作作为续体投递到 Future 所属的 Runtime，
+     * 因此等待期间不占用任何线程，也不会被轮询
+     */
+    auto operator co_await() {
+        struct Awaiter {
+            Future& future;
+
+            bool await_ready() const {
+                return future.IsReady();
+            }
+
+            void await_suspend(std::coroutine_handle<> h) {
+                assert(future.Valid());
+                future._state->SetCallback([h] { h.resume(); });
+            }
+
+            R await_resume() {
+                return future.Get();
+            }
+        };
+        return Awaiter{*this};
+    }
+#endif
+
+private:
+    template<typename F, bool = std::is_void_v<R>>
+    struct ContinuationResult {
+        using type = std::invoke_result_t<F, R>;
+    };
+
+    template<typename F>
+    struct ContinuationResult<F, true> {
+        using type = std::invoke_result_t<F>;
+    };
+};
+
+template<typename R>
+std::pair<Promise<R>, Future<R>> MakePromise(FutureExecutor exec) {
+    auto* state = new FutureState<R>(exec);
+    state->AddRef();
+    return { Promise<R>(state), Future<R>(state) };
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <Containers/CacheLine.h>
+
+/// InplaceTask 默认的内联存储大小：任务（存储 + 操作表指针）加上 RingQueue slot 的序号正好占一条 cache line
+inline constexpr size_t kInplaceTaskSize = kCacheLineSize - sizeof(void*) - sizeof(size_t);
+
+/**
+ * @class InplaceTask
+ * @brief 固定内联存储、只可移动的 void() 任务
+ *
+ * @details
+ * 作为 std::function<void()> 的替代，用于 LockFreeExecutor / ThreadExecutor 的 Task
+ * 以及 Consumer 的 T：
+ * - 可调用对象直接构造在内联存储中，从不分配堆内存；超过 Size / Align 的捕获在编译期报错
+ * - 只可移动：允许捕获 std::unique_ptr、std::promise 等只可移动的对象；
+ *   经过 RingQueue 时只移动内联存储，不会像 std::function 拷贝那样复制堆上的负载
+ * - 每种可调用类型对应一张静态操作表，对象本身只保存一个表指针；调用只有一次间接调用
+ * - 可平凡拷贝的可调用对象移动时直接 memcpy，可平凡析构的对象析构为空操作
+ * - 空任务指向一张「什么都不做」的操作表，调用为空操作，移动 / 析构无需判空
+ *
+ * 可调用对象的移动构造必须是 noexcept（队列在 slot 之间移动任务时不允许失败）。
+ *
+ * @code
+ *   LockFreeExecutor<InplaceTask<>> queue(4096);
+ *   ThreadExecutor<InplaceTask<>> executor(queue, 4);
+ *   executor.Submit(InplaceTask<>([buffer = std::make_unique<Buffer>()] { Process(*buffer); }));
+ * @endcode
+ *
+ * @tparam Size  内联存储字节数
+ * @tparam Align 内联存储对齐
+ *
+ * @author BUG
+ * @date 2025-12-30
+ */
+template<size_t Size = kInplaceTaskSize, size_t Align = alignof(void*)>
+class InplaceTask {
+public:
+    InplaceTask() noexcept = default;
+
+    /**
+     * @brief 在内联存储中构造可调用对象
+     * @tparam F 可调用类型，须满足 sizeof(F) <= Size、alignof(F) <= Align、noexcept 移动构造
+     */
+    template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InplaceTask> &&
+                                                     std::is_invocable_v<std::decay_t<F>&>>>
+    InplaceTask(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= Size, "InplaceTask: callable does not fit in the inline storage");
+        static_assert(alignof(Fn) <= Align, "InplaceTask: callable is over-aligned for the inline storage");
+        static_assert(std::is_nothrow_move_constructible_v<Fn>, "InplaceTask: callable must be nothrow movable");
+
+        ::new (static_cast<void*>(_storage)) Fn(std::forward<F>(f));
+        _ops = &kOps<Fn>;
+    }
+
+    InplaceTask(InplaceTask&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    InplaceTask& operator=(InplaceTask&& other) noexcept {
+        if (this != &other) {
+            Destroy();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceTask(const InplaceTask&) = delete;
+    InplaceTask& operator=(const InplaceTask&) = delete;
+
+    ~InplaceTask() {
+        Destroy();
+    }
+
+    /**
+     * @brief 执行任务（空任务为空操作）
+     * @details 与 std::function 相同，const 调用也会调用可调用对象的非 const operator()
+     */
+    void operator()() const {
+        _ops->invoke(const_cast<unsigned char*>(_storage));
+    }
+
+    /**
+     * @brief 是否持有可调用对象
+     */
+    explicit operator bool() const noexcept {
+        return _ops != &kEmptyOps;
+    }
+
+    /**
+     * @brief 析构持有的可调用对象，变为空任务
+     */
+    void Reset() noexcept {
+        Destroy();
+        _ops = &kEmptyOps;
+    }
+
+private:
+    /**
+     * @brief 每种可调用类型一张的操作表
+     * @details relocate / destroy 为 nullptr 表示可平凡拷贝 / 可平凡析构
+     */
+    struct Ops {
+        void (*invoke)(void* self);
+        void (*relocate)(void* dst, void* src) noexcept; ///< 移动构造到 dst 并析构 src
+        void (*destroy)(void* self) noexcept;
+    };
+
+    template<typename Fn>
+    static void Invoke(void* self) {
+        (*static_cast<Fn*>(self))();
+    }
+
+    template<typename Fn>
+    static void Relocate(void* dst, void* src) noexcept {
+        Fn* from = static_cast<Fn*>(src);
+        ::new (dst) Fn(std::move(*from));
+        from->~Fn();
+    }
+
+    template<typename Fn>
+    static void DestroyFn(void* self) noexcept {
+        static_cast<Fn*>(self)->~Fn();
+    }
+
+    static void InvokeEmpty(void*) {}
+
+    template<typename Fn>
+    static constexpr Ops kOps{
+        &Invoke<Fn>,
+        std::is_trivially_copyable_v<Fn> ? nullptr : &Relocate<Fn>,
+        std::is_trivially_destructible_v<Fn> ? nullptr : &DestroyFn<Fn>,
+    };
+
+    static constexpr Ops kEmptyOps{&InvokeEmpty, nullptr, nullptr};
+
+    void MoveFrom(InplaceTask& other) noexcept {
+        _ops = other._ops;
+        if (_ops->relocate) {
+            _ops->relocate(_storage, other._storage);
+        } else {
+            std::memcpy(_storage, other._storage, Size);
+        }
+        other._ops = &kEmptyOps;
+    }
+
+    void Destroy() noexcept {
+        if (_ops->destroy) _ops->destroy(_storage);
+    }
+
+private:
+    alignas(Align) unsigned char _storage[Size]; ///< 可调用对象的内联存储
+    const Ops* _ops = &kEmptyOps;                ///< 当前可调用类型的操作表
+};
@@ -2,6 +2,8 @@
 
 #include <cstddef>
 #include <functional>
+#include <optional>
+#include <utility>
 #include <Containers/RingQueue.h>
 
 /**
@@ -39,20 +41,30 @@
  * @tparam Task 任务类型
  *         - 常见为 std::function<void()>
  *         - 也可以是强类型任务结构体
+ * @tparam P 生产者并发模型
+ *         - 仅一个线程 Submit 时可选 Producers::Single，省去 CAS
+ * @tparam C 消费者并发模型
+ *         - 仅一个线程/协程调度器消费时可选 Consumers::Single
  *
  * @author BUG
  * @date 2025-12-22
  */
-template<typename Task>
+template<
+    typename Task,
+    Producers P = Producers::Multi,
+    Consumers C = Consumers::Multi
+>
 class LockFreeExecutor {
 public:
+    using Queue = RingQueue<Task, P, C>;
+
     /**
      * @brief 构造函数
      *
      * @param capacity 队列容量
      *
      * @note
-     * - capacity 是硬容量
+     * - capacity 是硬容量，会向上取整为 2 的幂
      * - 满时 Add() 会失败，不会阻塞
      */
     explicit LockFreeExecutor(size_t capacity)
@@ -83,12 +95,66 @@ public:
         return _queue.TryPush(task) == RingQueueResult::Ok;
     }
 
+    /**
+     * @brief 尝试移动添加一个任务
+     *
+     * @details
+     * - 语义同 Add(const Task&)
+     * - 仅在成功时移动 task，失败时 task 保持原样，可直接重试
+     * - 支持 move-only 任务（如 std::packaged_task）
+     */
+    bool Add(Task&& task) {
+        return _queue.TryPush(std::move(task)) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试在队列中原地构造一个任务
+     *
+     * @param args 传递给 Task 构造函数的参数
+     *
+     * @return 同 Add(const Task&)
+     */
+    template<typename... Args>
+    bool Emplace(Args&&... args) {
+        return _queue.TryEmplace(std::forward<Args>(args)...) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试添加一个任务并返回队列的原始结果
+     *
+     * @details
+     * - 语义同 Add，但区分 Full（队列已满）与 Busy（竞争失败，可立即重试）
+     * - 仅在返回 Ok 时转发 / 移动 task
+     *
+     * @return RingQueueResult::Ok / Full / Busy
+     */
+    template<typename U>
+    RingQueueResult TryAdd(U&& task) {
+        return _queue.TryPush(std::forward<U>(task));
+    }
+
+    /**
+     * @brief 尝试批量添加任务
+     *
+     * @details
+     * - 非阻塞，整段区间只消耗一次 CAS
+     * - 空间不足时只添加能容纳的前缀
+     * - 传入 std::make_move_iterator 可移动添加
+     *
+     * @return 实际添加的任务数量
+     */
+    template<typename It>
+    size_t AddBulk(It first, It last) {
+        return _queue.TryPushBulk(first, last);
+    }
+
     /**
      * @brief 尝试弹出一个任务
      *
      * @details
      * - 非阻塞
      * - 不等待任务到来
+     * - 任务被移动到 out，队列中不再保留副本
      *
      * @param out 用于接收任务
      *
@@ -100,6 +166,32 @@ public:
         return _queue.TryPop(out) == RingQueueResult::Ok;
     }
 
+    /**
+     * @brief 尝试弹出一个任务到 optional
+     *
+     * @details 适用于不可默认构造的任务类型
+     */
+    bool TryPop(std::optional<Task>& out) {
+        return _queue.TryPop(out) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试批量弹出任务
+     *
+     * @details
+     * - 非阻塞，整段区间只消耗一次 CAS
+     * - 任务依次移动写入 *out++
+     *
+     * @param out 输出迭代器
+     * @param max 最多弹出的任务数量
+     *
+     * @return 实际弹出的任务数量
+     */
+    template<typename OutIt>
+    size_t PopBulk(OutIt out, size_t max) {
+        return _queue.TryPopBulk(out, max);
+    }
+
     /**
      * @brief 获取当前队列大小（近似值）
      *
@@ -110,6 +202,13 @@ public:
         return _queue.SizeApprox();
     }
 
+    /**
+     * @brief 获取底层队列的失败路径计数（仅 -DEXECUTOR_METRICS 时非零）
+     */
+    RingQueueStats Stats() const {
+        return _queue.Stats();
+    }
+
 private:
-    RingQueue<Task> _queue; ///< 无锁任务队列
+    Queue _queue; ///< 无锁任务队列
 };
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <Executor/LockFreeExecutor.h>
+#include <Executor/ThreadConfig.h>
+#include <Executor/ThreadExecutor.h>
+
+/**
+ * @class NumaExecutorGroup
+ * @brief 每个 NUMA 节点一个 ThreadExecutor，提交路由到调用线程所在节点
+ *
+ * @details
+ * 对 NumaNodes() 中的每个节点：
+ * - 在绑定到该节点的临时线程上构造 LockFreeExecutor 与 ThreadExecutor（MakeOnNumaNode），
+ *   RingQueue 节点数组、WorkStealing 本地队列、指标分片都按 first-touch 落在本地内存
+ * - 工作线程绑定到该节点的 CPU 并优先在该节点分配内存，线程名为 name + 节点编号 + "-" + 线程编号
+ * - threadsPerNode 为 0 时每个 CPU 一个工作线程，并各自固定到一个 CPU；
+ *   否则 threadsPerNode 个线程共享该节点的全部 CPU
+ *
+ * 提交：
+ * - TrySubmit / Submit 按 CurrentCpu() 选择本节点的 ThreadExecutor，生产者与消费者共享同一节点的队列
+ * - TrySubmit 本节点队列满 / 竞争失败时依次尝试其他节点（跨节点溢出），全部失败才返回 false
+ * - Submit 只在本节点上等待空位（背压语义同 ThreadExecutor::Submit）
+ *
+ * 非 NUMA 机器上只有一个节点，等价于一个绑定到全部 CPU 的 ThreadExecutor。
+ *
+ * @tparam Task 任务类型
+ *
+ * @author BUG
+ * @date 2025-12-30
+ */
+template<typename Task>
+class NumaExecutorGroup {
+public:
+    /**
+     * @brief 构造函数
+     *
+     * @param queueCapacity  每个节点共享队列的容量
+     * @param threadsPerNode 每个节点的工作线程数，0 表示每个 CPU 一个
+     * @param mode           任务分发模式
+     * @param name           线程名前缀
+     *
+     * @note 不创建工作线程，仅在各节点上准备资源
+     */
+    explicit NumaExecutorGroup(
+        size_t queueCapacity,
+        size_t threadsPerNode = 0,
+        ThreadExecutorMode mode = ThreadExecutorMode::Shared,
+        const std::string& name = "exec")
+    {
+        for (const NumaNode& node : NumaNodes()) {
+            size_t threads = threadsPerNode == 0 ? node.cpus.size() : threadsPerNode;
+            auto shard = MakeOnNumaNode<Shard>(node.id, queueCapacity, threads, mode);
+
+            ThreadConfig config;
+            config.name = name + std::to_string(node.id) + "-";
+            config.cpus = node.cpus;
+            config.pinEach = threadsPerNode == 0;
+            config.numaNode = node.id;
+            shard->executor.SetThreadConfig(std::move(config));
+
+            _shards.push_back(std::move(shard));
+        }
+    }
+
+    /**
+     * @brief 启动所有节点的 Runtime
+     */
+    void Start() {
+        for (auto& shard : _shards) shard->executor.Start();
+    }
+
+    /**
+     * @brief 停止所有节点的 Runtime
+     * @note 不保证任务全部执行完成
+     */
+    void Stop() {
+        for (auto& shard : _shards) shard->executor.Stop();
+    }
+
+    /**
+     * @brief 尝试提交到本节点，失败时溢出到其他节点（不等待）
+     *
+     * @return false 所有节点都已满或竞争失败，task 保持原样
+     */
+    bool TrySubmit(const Task& task) {
+        return Offer(task);
+    }
+
+    /**
+     * @brief 尝试提交（移动），仅在成功时移动 task
+     */
+    bool TrySubmit(Task&& task) {
+        return Offer(std::move(task));
+    }
+
+    /**
+     * @brief 提交到本节点，队列满时等待空位
+     * @return false Runtime 未运行且队列已满，task 保持原样
+     */
+    bool Submit(const Task& task) {
+        return Local().Submit(task);
+    }
+
+    /**
+     * @brief 提交（移动）到本节点，队列满时等待空位
+     */
+    bool Submit(Task&& task) {
+        return Local().Submit(std::move(task));
+    }
+
+    /**
+     * @brief 节点数量
+     */
+    size_t NodeCount() const {
+        return _shards.size();
+    }
+
+    /**
+     * @brief 第 index 个节点（NumaNodes() 顺序）的 Runtime
+     * @details 用于显式指定节点提交、按节点读取 Metrics()
+     */
+    ThreadExecutor<Task>& Node(size_t index) {
+        return _shards[index]->executor;
+    }
+
+    /**
+     * @brief 调用线程当前所在节点（NumaNodes() 下标）
+     */
+    size_t LocalNode() const {
+        size_t index = NumaNodeIndexOfCpu(CurrentCpu());
+        return index < _shards.size() ? index : 0;
+    }
+
+private:
+    /**
+     * @brief 一个节点的队列与 Runtime（在节点本地内存上构造）
+     */
+    struct Shard {
+        Shard(size_t capacity, size_t threads, ThreadExecutorMode mode)
+            : queue(capacity), executor(queue, threads, mode) {}
+
+        LockFreeExecutor<Task> queue;
+        ThreadExecutor<Task> executor; ///< 声明在 queue 之后：先析构（Stop）再释放队列
+    };
+
+    ThreadExecutor<Task>& Local() {
+        return _shards[LocalNode()]->executor;
+    }
+
+    /**
+     * @brief 本节点优先、依次溢出到其他节点
+     */
+    template<typename U>
+    bool Offer(U&& task) {
+        size_t local = LocalNode();
+        for (size_t i = 0; i < _shards.size(); ++i) {
+            ThreadExecutor<Task>& executor = _shards[(local + i) % _shards.size()]->executor;
+            if (executor.TrySubmit(std::forward<U>(task))) return true;
+        }
+        return false;
+    }
+
+private:
+    std::vector<std::unique_ptr<Shard>> _shards; ///< 每个 NUMA 节点一份
+};
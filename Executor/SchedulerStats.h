@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <Containers/RingQueue.h>
+
+/**
+ * @brief 协程调度器计数快照
+ *
+ * @details
+ * - resumes     实际恢复协程的次数（只在有任务或就绪句柄时发生）
+ * - emptyPolls  查询队列但没有取到任何工作的次数
+ *
+ * 空闲时 resumes 应保持不变；emptyPolls 的增长速度反映退避 / 停车策略的空转成本。
+ */
+struct SchedulerStats {
+    size_t resumes = 0;
+    size_t emptyPolls = 0;
+};
+
+/**
+ * @brief 单个调度线程的计数器
+ *
+ * @details
+ * - 只由所属调度线程写入（relaxed load + store，无 RMW）
+ * - 独占 cache line，读取方聚合时不干扰热路径
+ */
+struct alignas(kCacheLineSize) SchedulerCounters {
+    std::atomic<size_t> resumes{0};
+    std::atomic<size_t> emptyPolls{0};
+
+    void AddResume() {
+        resumes.store(resumes.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void AddEmptyPoll() {
+        emptyPolls.store(emptyPolls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void AccumulateTo(SchedulerStats& stats) const {
+        stats.resumes += resumes.load(std::memory_order_relaxed);
+        stats.emptyPolls += emptyPolls.load(std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
+
+inline constexpr size_t kThreadNameMax = 15; ///< Linux 线程名的最大长度（不含结尾 '\0'）
+
+/**
+ * @brief 工作线程的放置与命名配置
+ *
+ * @details
+ * 由 Runtime（ThreadExecutor / CoroutineExecutorMT / ThreadConsumer）的 SetThreadConfig() 传入，
+ * 每个工作线程进入主循环前调用 ApplyThreadConfig(config, index)：
+ *   1. 命名：name + 线程编号（Linux 限制 15 字节，超出时截断前缀、保留编号）
+ *   2. 内存：numaNode >= 0 时把本线程的内存分配策略设为优先该节点（MPOL_PREFERRED），
+ *      节点内存不足时回退到其他节点而不是失败
+ *   3. CPU：cpus 非空时绑定到 cpus；cpus 为空且 numaNode >= 0 时绑定到该节点的全部 CPU；
+ *      pinEach 为 true 时第 i 个线程只绑定一个 CPU（按编号轮转）
+ *   4. onStart(index)：自定义钩子（如设置调度优先级）
+ *
+ * 默认值不做任何设置。各步骤失败（权限不足、非 Linux 平台）只影响放置，不影响执行。
+ *
+ * @author BUG
+ * @date 2025-12-30
+ */
+struct ThreadConfig {
+    std::string name;                    ///< 线程名前缀，空表示不命名
+    std::vector<int> cpus;               ///< 可运行的 CPU 编号，空表示不限制
+    bool pinEach = false;                ///< 每个线程只绑定 cpus 中的一个 CPU
+    int numaNode = -1;                   ///< 内存优先分配的 NUMA 节点，-1 表示不设置
+    std::function<void(size_t)> onStart; ///< 放置完成后、进入主循环前的钩子
+};
+
+/**
+ * @brief NUMA 节点及其 CPU
+ */
+struct NumaNode {
+    int id = 0;            ///< 内核中的节点编号
+    std::vector<int> cpus; ///< 属于该节点的 CPU 编号
+};
+
+/**
+ * @brief 解析内核 CPU / 节点列表格式（如 "0-3,8,10-11"）
+ */
+inline std::vector<int> ParseCpuList(const std::string& list) {
+    std::vector<int> result;
+    const char* p = list.c_str();
+    while (*p) {
+        char* end = nullptr;
+        long first = std::strtol(p, &end, 10);
+        if (end == p) break;
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = std::strtol(p + 1, &end, 10);
+            if (end == p + 1) break;
+            p = end;
+        }
+        for (long cpu = first; cpu <= last; ++cpu) result.push_back(static_cast<int>(cpu));
+        if (*p != ',') break;
+        ++p;
+    }
+    return result;
+}
+
+/**
+ * @brief 当前机器的 NUMA 拓扑
+ *
+ * @details
+ * 读取 /sys/devices/system/node，首次调用时解析并缓存。
+ * 非 NUMA 机器、非 Linux 平台或无法读取时返回单个节点 0，包含全部 CPU。
+ */
+inline const std::vector<NumaNode>& NumaNodes() {
+    static const std::vector<NumaNode> nodes = [] {
+        std::vector<NumaNode> result;
+#ifdef __linux__
+        auto readLine = [](const std::string& path) {
+            std::ifstream in(path);
+            std::string line;
+            std::getline(in, line);
+            return line;
+        };
+        for (int id : ParseCpuList(readLine("/sys/devices/system/node/online"))) {
+            NumaNode node;
+            node.id = id;
+            node.cpus = ParseCpuList(readLine("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist"));
+            if (!node.cpus.empty()) result.push_back(std::move(node));
+        }
+#endif
+        if (result.empty()) {
+            NumaNode node;
+            unsigned count = std::thread::hardware_concurrency();
+            for (unsigned cpu = 0; cpu < (count == 0 ? 1 : count); ++cpu) node.cpus.push_back(static_cast<int>(cpu));
+            result.push_back(std::move(node));
+        }
+        return result;
+    }();
+    return nodes;
+}
+
+/**
+ * @brief 按内核节点编号查找节点
+ * @return 找不到时返回 nullptr
+ */
+inline const NumaNode* FindNumaNode(int id) {
+    for (const NumaNode& node : NumaNodes()) {
+        if (node.id == id) return &node;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 当前线程正在运行的 CPU
+ * @return 无法获取时返回 -1
+ */
+inline int CurrentCpu() {
+#ifdef __linux__
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief CPU 所属节点在 NumaNodes() 中的下标
+ * @return 未知 CPU 返回 0
+ */
+inline size_t NumaNodeIndexOfCpu(int cpu) {
+    static const std::vector<size_t> lookup = [] {
+        std::vector<size_t> table;
+        const auto& nodes = NumaNodes();
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            for (int c : nodes[i].cpus) {
+                if (static_cast<size_t>(c) >= table.size()) table.resize(c + 1, 0);
+                table[c] = i;
+            }
+        }
+        return table;
+    }();
+    return cpu >= 0 && static_cast<size_t>(cpu) < lookup.size() ? lookup[cpu] : 0;
+}
+
+/**
+ * @brief 设置当前线程名
+ * @return false 平台不支持或设置失败
+ */
+inline bool SetCurrentThreadName(const std::string& name) {
+#ifdef __linux__
+    std::string truncated = name.substr(0, kThreadNameMax);
+    return pthread_setname_np(pthread_self(), truncated.c_str()) == 0;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+/**
+ * @brief 把当前线程绑定到一组 CPU
+ * @return false 平台不支持、CPU 编号无效或权限不足
+ */
+inline bool PinCurrentThread(const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+    }
+    if (CPU_COUNT(&set) == 0) return false;
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+/**
+ * @brief 当前线程此后的内存分配优先落在 node 上（first-touch 时生效）
+ * @return false 平台不支持、内核未开启 NUMA 或权限不足
+ */
+inline bool PreferNumaNode(int node) {
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    constexpr size_t kBits = sizeof(unsigned long) * 8;
+    if (node < 0) return false;
+    std::vector<unsigned long> mask(static_cast<size_t>(node) / kBits + 1, 0);
+    mask[node / kBits] |= 1ul << (node % kBits);
+    return syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), mask.size() * kBits + 1) == 0;
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+/**
+ * @brief 在当前（工作）线程上应用 ThreadConfig
+ *
+ * @param config 线程配置
+ * @param index  工作线程编号，用于命名与 pinEach 轮转
+ *
+ * @return true 所有请求的设置都成功（onStart 不计入）
+ */
+inline bool ApplyThreadConfig(const ThreadConfig& config, size_t index) {
+    bool ok = true;
+    if (!config.name.empty()) {
+        std::string suffix = std::to_string(index);
+        size_t keep = suffix.size() < kThreadNameMax ? kThreadNameMax - suffix.size() : 0;
+        ok &= SetCurrentThreadName(config.name.substr(0, keep) + suffix);
+    }
+    if (config.numaNode >= 0) {
+        ok &= PreferNumaNode(config.numaNode);
+    }
+
+    const std::vector<int>* cpus = &config.cpus;
+    if (cpus->empty() && config.numaNode >= 0) {
+        const NumaNode* node = FindNumaNode(config.numaNode);
+        if (node) cpus = &node->cpus;
+    }
+    if (!cpus->empty()) {
+        ok &= config.pinEach ? PinCurrentThread({(*cpus)[index % cpus->size()]}) : PinCurrentThread(*cpus);
+    }
+
+    if (config.onStart) config.onStart(index);
+    return ok;
+}
+
+/**
+ * @brief 在绑定到 NUMA 节点的临时线程上执行 f 并等待完成
+ *
+ * @details
+ * 页在第一次写入时才分配物理内存（first-touch），因此在该线程上构造的队列
+ * （RingQueue 构造时写入全部 slot 的序号）其节点数组落在 node 的本地内存上。
+ */
+template<typename F>
+void RunOnNumaNode(int node, F&& f) {
+    std::thread worker([&] {
+        ThreadConfig config;
+        config.numaNode = node;
+        ApplyThreadConfig(config, 0);
+        f();
+    });
+    worker.join();
+}
+
+/**
+ * @brief 在 NUMA 节点本地内存上构造对象
+ *
+ * @code
+ *   auto queue = MakeOnNumaNode<LockFreeExecutor<Task>>(node.id, 4096);
+ * @endcode
+ */
+template<typename T, typename... Args>
+std::unique_ptr<T> MakeOnNumaNode(int node, Args&&... args) {
+    std::unique_ptr<T> result;
+    RunOnNumaNode(node, [&] { result = std::make_unique<T>(std::forward<Args>(args)...); });
+    return result;
+}
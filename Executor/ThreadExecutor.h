@@ -3,7 +3,29 @@
 #include <thread>
 #include <vector>
 #include <atomic>
-#include <condition_variable>
+#include <utility>
+#include <iterator>
+#include <memory>
+#include <functional>
+#include <optional>
+#include <cstdint>
+#include <chrono>
+#include <type_traits>
+#include <Containers/WorkStealingDeque.h>
+#include <Executor/EventCount.h>
+#include <Executor/Backpressure.h>
+#include <Executor/ExecutorLanes.h>
+#include <Executor/ExecutorMetrics.h>
+#include <Executor/LockFreeExecutor.h>
+#include <Executor/ThreadConfig.h>
+
+/**
+ * @brief ThreadExecutor 的任务分发模式
+ */
+enum class ThreadExecutorMode {
+    Shared,       ///< 所有工作线程竞争同一个 LockFreeExecutor
+    WorkStealing, ///< 每个工作线程拥有本地队列，空闲时从其他线程窃取
+};
 
 /**
  * @class ThreadExecutor
@@ -31,6 +53,7 @@
  *
  * ThreadExecutor 依赖：
  *   - LockFreeExecutor<Task>
+ *   - WorkStealingDeque<Task>（仅 WorkStealing 模式）
  *
  * 协作方式：
  *   - LockFreeExecutor 负责：
@@ -39,6 +62,20 @@
  *       * wait / notify
  *       * 线程调度
  *
+ * WorkStealing 模式：
+ *   - 每个工作线程拥有一个 Chase-Lev 双端队列和一个投递收件箱
+ *   - 工作线程内 Submit → 本地双端队列（LIFO，无 CAS）
+ *   - 外部线程 Submit → 按轮转投递到各线程收件箱
+ *   - 本地队列已满 → 回退到共享的 LockFreeExecutor
+ *   - 取任务顺序：本地队列 → 收件箱 → 共享队列 → 随机窃取其他线程
+ *
+ * 优先级通道（ExecutorLanes，可选）：
+ *   - 通道 0 即上述全部队列（Submit / TrySubmit），通道 1..N-1 为内部创建的低优先级队列
+ *     （SubmitTo / TrySubmitTo）
+ *   - 工作线程按严格优先级或加权轮转（每通道每轮的取出份额）选择通道，
+ *     洪泛的批量任务只占用低优先级通道的份额，不会排在交互任务前面
+ *   - 任务带截止时间（Deadline()，如 DeadlineTask<F>）时，出队后已过期的任务直接丢弃
+ *
  * ============================================================
  * 三、并发模型（Concurrency Model）
  * ============================================================
@@ -47,15 +84,18 @@
  * - 多消费者：多个工作线程并行执行
  *
  * - Executor 层：无锁 / Try 语义
- * - Runtime 层：允许阻塞（condition_variable）
+ * - Runtime 层：允许阻塞（EventCount 停车，自旋后才睡眠）
  *
  * ============================================================
  * 四、不变量（Invariants）【非常重要】
  * ============================================================
  *
- * 1. ThreadExecutor 永远不会存储任务
+ * 1. Shared 模式下 ThreadExecutor 不存储任务（仅工作线程本地的批处理缓冲）；
+ *    WorkStealing 模式下任务只存放在各工作线程的本地队列中
+ *    低优先级通道是内部创建的 LockFreeExecutor，仍由 Executor 层存储任务
  * 2. ThreadExecutor 永远不会关心队列容量
- * 3. ThreadExecutor 不实现重试、超时、批处理
+ * 3. 重试 / 超时只存在于提交侧背压（Submit / SubmitFor，见 Executor/Backpressure.h），
+ *    TrySubmit 始终只尝试一次；批量存取由 Executor 层的 AddBulk / PopBulk 完成
  * 4. 所有等待策略只存在于 Runtime
  *
  * 破坏以上任一条，都会导致 Executor / Runtime 边界崩溃
@@ -86,14 +126,35 @@ public:
      *
      * @param executor 任务容器（Executor 层）
      * @param threadCount 工作线程数量
+     * @param mode 任务分发模式
+     * @param localCapacity WorkStealing 模式下每个线程本地队列的容量
+     * @param lanes 优先级通道配置（默认单通道）
      *
      * @note
      * - executor 的生命周期必须长于 ThreadExecutor
      * - 不创建线程，仅做资源准备
+     * - WorkStealing 模式下 executor 作为本地队列满时的溢出队列
+     * - executor 为最高优先级的通道 0，其余通道由 ThreadExecutor 创建并持有
      */
-    ThreadExecutor(LockFreeExecutor<Task>& executor, size_t threadCount)
-        : _executor(executor), _running(false) {
+    ThreadExecutor(
+        LockFreeExecutor<Task>& executor,
+        size_t threadCount,
+        ThreadExecutorMode mode = ThreadExecutorMode::Shared,
+        size_t localCapacity = 256,
+        const ExecutorLanes& lanes = {})
+        : _executor(executor), _running(false), _mode(mode),
+          _laneWeights(lanes.weights), _metrics(threadCount) {
         _threads.resize(threadCount);
+
+        for (size_t i = 1; i < lanes.count; ++i) {
+            _lanes.push_back(std::make_unique<LockFreeExecutor<Task>>(lanes.capacity));
+        }
+
+        if (_mode == ThreadExecutorMode::WorkStealing) {
+            for (size_t i = 0; i < threadCount; ++i) {
+                _workers.push_back(std::make_unique<Worker>(localCapacity));
+            }
+        }
     }
 
     /**
@@ -108,6 +169,17 @@ public:
         Stop();
     }
 
+    /**
+     * @brief 设置工作线程的命名 / CPU 绑定 / NUMA 内存策略（见 ThreadConfig）
+     *
+     * @note
+     * - 只能在 Start() 之前调用
+     * - 每个工作线程进入主循环前以自己的编号调用 ApplyThreadConfig
+     */
+    void SetThreadConfig(ThreadConfig config) {
+        _threadConfig = std::move(config);
+    }
+
     /**
      * @brief 启动 Runtime
      *
@@ -123,8 +195,12 @@ public:
         if (_running.exchange(true))
             return;
 
-        for (auto& t : _threads) {
-            t = std::thread(&ThreadExecutor::WorkerLoop, this);
+        for (size_t i = 0; i < _threads.size(); ++i) {
+            if (_mode == ThreadExecutorMode::WorkStealing) {
+                _threads[i] = std::thread(&ThreadExecutor::StealingLoop, this, i);
+            } else {
+                _threads[i] = std::thread(&ThreadExecutor::WorkerLoop, this, i);
+            }
         }
     }
 
@@ -132,46 +208,245 @@ public:
      * @brief 停止 Runtime
      *
      * @details
-     * - 设置运行状态为 false
+     * - 设置运行状态为 false，此后的提交都被拒绝
+     * - 等待已通过运行检查的提交完成入队
      * - 唤醒所有等待线程
      * - join 等待线程退出
+     * - 析构仍留在各队列中的任务（共享队列、低优先级通道、WorkStealing 本地队列 / 收件箱）
      *
      * @note
-     * Stop 不保证任务全部执行完成
+     * Stop 不保证任务全部执行完成：未执行的任务被丢弃，
+     * 其中的 Promise 随之以 broken_promise 完成（见 Future.h）
      */
     void Stop() {
-        if (!_running.exchange(false))
+        if (!_running.exchange(false, std::memory_order_seq_cst))
             return;
 
-        _cv.notify_all();
+        while (_inFlight.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+
+        _parking.NotifyAll();
+        _space.NotifyAll();
 
         for (auto& t : _threads) {
             if (t.joinable())
                 t.join();
         }
+
+        DiscardPending();
     }
 
     /**
-     * @brief 提交任务
+     * @brief 尝试提交任务（不等待）
      *
      * @details
-     * - 线程安全
-     * - 仅负责转发任务到 Executor
+     * - 线程安全，只尝试一次
+     * - Shared 模式仅负责转发任务到 Executor
+     * - WorkStealing 模式优先投递到本地队列 / 收件箱
      * - 成功后负责唤醒一个线程
      *
      * @return
      * - true  提交成功
-     * - false Executor 满或竞争失败
+     * - false Runtime 未运行、Executor 满或竞争失败，task 保持原样，可直接重试
+     */
+    bool TrySubmit(const Task& task) {
+        return Offer(task) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试提交任务（移动，不等待）
+     *
+     * @details
+     * - 语义同 TrySubmit(const Task&)
+     * - 仅在成功时移动 task
+     */
+    bool TrySubmit(Task&& task) {
+        return Offer(std::move(task)) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 提交任务，队列满时等待空位
+     *
+     * @details
+     * - 竞争失败（Busy）立即重试；队列满时自旋 → yield → 停车，
+     *   直到工作线程取走任务后唤醒（见 SubmitWithBackpressure）
+     * - 在本 Runtime 的工作线程内调用且队列已满时，直接在当前线程执行 task（caller-runs），
+     *   避免所有工作线程都在等待空位而自锁
+     *
+     * @return
+     * - true  已入队（或已在当前工作线程执行）
+     * - false Runtime 未运行（未 Start() 或已 Stop()），task 保持原样
      */
     bool Submit(const Task& task) {
-        bool ok = _executor.Add(task);
-        if (ok) {
-            _cv.notify_one();
+        return SubmitUntil(task, std::nullopt);
+    }
+
+    /**
+     * @brief 提交任务（移动），队列满时等待空位
+     * @details 语义同 Submit(const Task&)，仅在成功时移动 task
+     */
+    bool Submit(Task&& task) {
+        return SubmitUntil(std::move(task), std::nullopt);
+    }
+
+    /**
+     * @brief 提交任务，队列满时最多等待 timeout
+     *
+     * @details 等待方式同 Submit(const Task&)
+     *
+     * @return false 超时或 Runtime 已停止，task 保持原样
+     */
+    template<typename Rep, typename Period>
+    bool SubmitFor(const Task& task, std::chrono::duration<Rep, Period> timeout) {
+        return SubmitUntil(task, std::chrono::steady_clock::now() + timeout);
+    }
+
+    /**
+     * @brief 提交任务（移动），队列满时最多等待 timeout
+     */
+    template<typename Rep, typename Period>
+    bool SubmitFor(Task&& task, std::chrono::duration<Rep, Period> timeout) {
+        return SubmitUntil(std::move(task), std::chrono::steady_clock::now() + timeout);
+    }
+
+    /**
+     * @brief 提交任务，队列满时在调用线程直接执行（caller-runs）
+     *
+     * @details
+     * - 竞争失败（Busy）立即重试，只有 Full 才回退为直接执行
+     * - 直接执行天然限制了生产速度，不会丢弃任务也不会阻塞
+     *
+     * @return
+     * - true  已入队
+     * - false 队列已满或 Runtime 未运行，task 已在调用线程执行完毕
+     */
+    bool SubmitOrRun(const Task& task) {
+        return OfferOrRun(task);
+    }
+
+    /**
+     * @brief 提交任务（移动），队列满时在调用线程直接执行
+     */
+    bool SubmitOrRun(Task&& task) {
+        return OfferOrRun(std::move(task));
+    }
+
+    /**
+     * @brief 尝试提交任务到指定优先级通道（不等待）
+     *
+     * @details
+     * - 语义同 TrySubmit(const Task&)；lane 0 等价于 TrySubmit
+     * - lane 超出范围时投递到优先级最低的通道
+     * - 低优先级通道的任务不经过 WorkStealing 本地队列
+     */
+    bool TrySubmitTo(size_t lane, const Task& task) {
+        return Offer(task, ClampLane(lane)) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 尝试提交任务（移动）到指定优先级通道（不等待）
+     */
+    bool TrySubmitTo(size_t lane, Task&& task) {
+        return Offer(std::move(task), ClampLane(lane)) == RingQueueResult::Ok;
+    }
+
+    /**
+     * @brief 提交任务到指定优先级通道，通道满时等待空位
+     * @details 等待方式同 Submit(const Task&)；每个通道各自有界，低优先级通道满不影响高优先级提交
+     */
+    bool SubmitTo(size_t lane, const Task& task) {
+        return SubmitUntil(task, std::nullopt, ClampLane(lane));
+    }
+
+    /**
+     * @brief 提交任务（移动）到指定优先级通道，通道满时等待空位
+     */
+    bool SubmitTo(size_t lane, Task&& task) {
+        return SubmitUntil(std::move(task), std::nullopt, ClampLane(lane));
+    }
+
+    /**
+     * @brief 当前线程是否为本 Runtime 的工作线程
+     * @details 供需要等待自己所提交任务的调用方判断：在工作线程内阻塞等待可能自锁，应改为直接执行
+     */
+    bool InWorkerThread() const {
+        return _tlsOwner == this;
+    }
+
+    /**
+     * @brief 优先级通道数量（含通道 0）
+     */
+    size_t LaneCount() const {
+        return _lanes.size() + 1;
+    }
+
+    /**
+     * @brief 批量提交任务
+     *
+     * @details
+     * - 线程安全
+     * - 整段区间只消耗一次 CAS
+     * - 空间不足时只提交能容纳的前缀
+     *
+     * @return 实际提交的任务数量；Runtime 未运行时为 0
+     */
+    template<typename It>
+    size_t SubmitBulk(It first, It last) {
+        InFlightGuard guard(_inFlight);
+        if (!_running.load(std::memory_order_seq_cst))
+            return 0;
+
+        size_t count = 0;
+        if (_mode == ThreadExecutorMode::WorkStealing && !_workers.empty()) {
+            if (_tlsOwner == this) {
+                Worker& self = *_workers[_tlsIndex];
+                for (; first != last; ++first, ++count) {
+                    if (self.deque.TryPush(*first) != RingQueueResult::Ok) break;
+                }
+            } else {
+                Worker& target = *_workers[_tlsRoundRobin++ % _workers.size()];
+                size_t n = target.inbox.TryPushBulk(first, last);
+                std::advance(first, n);
+                count += n;
+            }
         }
-        return ok;
+        count += _executor.AddBulk(first, last);
+        _metrics.AddSubmitted(count);
+        if (count == 1) {
+            _parking.NotifyOne();
+        } else if (count > 1) {
+            _parking.NotifyAll();
+        }
+        return count;
+    }
+
+    /**
+     * @brief 获取运行指标快照
+     *
+     * @details
+     * - 仅在 -DEXECUTOR_METRICS 时计数，否则只有 queueDepth 有效
+     * - 按需聚合各线程分片，可在任意线程调用，不影响热路径
+     * - 等待时间直方图只统计带入队时间戳的任务（如 TimedTask<F>），Submit 时打戳
+     * - SubmitBulk 只计入 submitted
+     * - queueDepth 为所有通道共享队列的深度之和
+     */
+    ExecutorStats Metrics() const {
+        return _metrics.Snapshot(LanesSizeApprox());
     }
 
 private:
+    /**
+     * @brief WorkStealing 模式下每个工作线程的本地队列
+     */
+    struct alignas(kCacheLineSize) Worker {
+        explicit Worker(size_t capacity)
+            : deque(capacity), inbox(capacity) {}
+
+        WorkStealingDeque<Task> deque; ///< 本线程提交的任务（所有者 LIFO，窃取者 FIFO）
+        RingQueue<Task> inbox;         ///< 外部线程投递的任务
+    };
+
     /**
      * @brief 工作线程主循环
      *
@@ -180,8 +455,8 @@ private:
      * ========================================================
      *
      * while (running):
-     *   if TryPop 成功:
-     *       执行任务
+     *   if 按通道策略 PopBulk 弹出 n > 0 个任务:
+     *       依次执行任务（已过期的任务丢弃）
      *   else:
      *       进入等待
      *
@@ -189,29 +464,389 @@ private:
      * 设计说明：
      * ========================================================
      *
-     * - TryPop 永远不阻塞
-     * - 阻塞行为只发生在 condition_variable
+     * - PopBulk 永远不阻塞，一次唤醒最多取 kBatchSize 个任务
+     * - 批次过大会让单个线程囤积任务，其余线程饥饿，因此保持较小的批次
+     * - 阻塞行为只发生在 Park（EventCount），先自旋 kSpinCount 次再睡眠
      * - 这是 Runtime 层的核心逻辑
      */
-    void WorkerLoop() {
-        while (_running.load()) {
-            Task task;
+    void WorkerLoop(size_t index) {
+        ApplyThreadConfig(_threadConfig, index);
+        _tlsOwner = this;
+        _tlsIndex = index;
 
-            if (_executor.TryPop(task)) {
+        WorkerMetrics& metrics = _metrics.Worker(index);
+        LaneCursor cursor(_laneWeights);
+        std::vector<Task> batch;
+        batch.reserve(kBatchSize);
+
+        auto tryRun = [&] {
+            if (PopLanes(cursor, batch) == 0)
+                return false;
+            _space.NotifyAll();
+            uint64_t start = metrics.Now();
+            for (auto& task : batch) {
+                if (TaskExpired(task)) {
+                    metrics.AddShed();
+                    continue;
+                }
+                metrics.BeginTask(task, start);
                 task();
+                start = metrics.EndTask(start);
+            }
+            batch.clear();
+            return true;
+        };
+
+        while (_running.load()) {
+            Park(metrics, tryRun, [&] { return LanesSizeApprox() > 0; });
+        }
+
+        _tlsOwner = nullptr;
+    }
+
+    /**
+     * @brief 工作窃取模式下的工作线程主循环
+     *
+     * ========================================================
+     * 执行逻辑：
+     * ========================================================
+     *
+     * while (running):
+     *   if FindTask 成功:
+     *       执行任务
+     *   else:
+     *       进入等待
+     *
+     * @param index 工作线程编号，对应 _workers[index]
+     */
+    void StealingLoop(size_t index) {
+        ApplyThreadConfig(_threadConfig, index);
+        _tlsOwner = this;
+        _tlsIndex = index;
+
+        Worker& self = *_workers[index];
+        WorkerMetrics& metrics = _metrics.Worker(index);
+        uint64_t seed = (index + 1) * 0x9E3779B97F4A7C15ull;
+        LaneCursor cursor(_laneWeights);
+        std::optional<Task> task;
+
+        auto tryRun = [&] {
+            if (!FindTask(index, self, seed, cursor, task))
+                return false;
+            if (TaskExpired(*task)) {
+                metrics.AddShed();
+                task.reset();
+                return true;
+            }
+            uint64_t start = metrics.Now();
+            metrics.BeginTask(*task, start);
+            (*task)();
+            metrics.EndTask(start);
+            task.reset();
+            return true;
+        };
+
+        while (_running.load()) {
+            Park(metrics, tryRun, [&] { return HasPendingApprox(); });
+        }
+
+        _tlsOwner = nullptr;
+    }
+
+    /**
+     * @brief 执行一轮「取任务 → 自旋 → 停车」
+     *
+     * ========================================================
+     * 执行逻辑：
+     * ========================================================
+     *
+     *   1. tryRun 成功 → 返回（调用者继续循环）
+     *   2. 自旋 kSpinCount 次重试，每次 CpuRelax
+     *   3. PrepareWait 登记为等待者后再检查一次：
+     *      - tryRun 成功或 pending() 为真 → CancelWait
+     *      - Runtime 已停止 → CancelWait
+     *      - 否则 Wait 睡眠，直到 Submit / Stop 唤醒
+     *
+     * pending() 用于区分「队列为空」与「竞争失败 / 生产者尚未发布」，
+     * 后者只需继续自旋，不应睡眠。
+     *
+     * @param metrics 本线程的指标分片，真正睡眠时计一次 park
+     */
+    template<typename TryRun, typename Pending>
+    void Park(WorkerMetrics& metrics, TryRun& tryRun, Pending&& pending) {
+        for (size_t spin = 0; spin < kSpinCount; ++spin) {
+            if (tryRun()) return;
+            CpuRelax();
+        }
+
+        auto key = _parking.PrepareWait();
+        if (tryRun() || pending() || !_running.load()) {
+            _parking.CancelWait();
+            return;
+        }
+        metrics.AddPark();
+        _parking.Wait(key);
+    }
+
+    /**
+     * @brief 析构所有队列中剩余的任务（Stop() 中工作线程 join 之后调用）
+     * @details 此时已没有工作线程与在途提交，调用线程是各队列（含本地双端队列）唯一的访问者
+     */
+    void DiscardPending() {
+        std::optional<Task> task;
+        for (size_t lane = 0; lane < LaneCount(); ++lane) {
+            while (Lane(lane).TryPop(task)) task.reset();
+        }
+        for (auto& worker : _workers) {
+            while (worker->deque.TryPop(task) == RingQueueResult::Ok) task.reset();
+            while (worker->inbox.TryPop(task) == RingQueueResult::Ok) task.reset();
+        }
+    }
+
+    /**
+     * @brief WorkStealing 模式下是否还有未取走的任务（近似值）
+     */
+    bool HasPendingApprox() const {
+        if (LanesSizeApprox() > 0) return true;
+        for (const auto& worker : _workers) {
+            if (worker->deque.SizeApprox() > 0 || worker->inbox.SizeApprox() > 0)
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief 弹出一批任务（Shared 模式）
+     *
+     * @details
+     * 单通道时直接 PopBulk 共享队列；多通道时由 cursor 选择通道，
+     * 每次只从一个通道取，最多 kBatchSize 个（严格优先级下低优先级通道每次一个）
+     *
+     * @return 放入 batch 的任务数
+     */
+    size_t PopLanes(LaneCursor& cursor, std::vector<Task>& batch) {
+        if (_lanes.empty())
+            return _executor.PopBulk(std::back_inserter(batch), kBatchSize);
+
+        return cursor.Next(LaneCount(), [&](size_t lane, size_t limit) {
+            return Lane(lane).PopBulk(std::back_inserter(batch), limit < kBatchSize ? limit : kBatchSize);
+        });
+    }
+
+    /**
+     * @brief 按通道策略查找一个任务（WorkStealing 模式）
+     *
+     * @details
+     * 通道 0 为「本地 → 收件箱 → 共享 → 窃取」（FindLocalTask），
+     * 其余通道直接从对应的共享队列取
+     */
+    bool FindTask(size_t index, Worker& self, uint64_t& seed, LaneCursor& cursor, std::optional<Task>& task) {
+        if (_lanes.empty())
+            return FindLocalTask(index, self, seed, task);
+
+        return cursor.Next(LaneCount(), [&](size_t lane, size_t) -> size_t {
+            if (lane == 0)
+                return FindLocalTask(index, self, seed, task) ? 1 : 0;
+            if (!_lanes[lane - 1]->TryPop(task))
+                return 0;
+            _space.NotifyOne();
+            return 1;
+        }) > 0;
+    }
+
+    /**
+     * @brief 按「本地 → 收件箱 → 共享 → 窃取」顺序查找一个任务
+     *
+     * @details
+     * 窃取从随机受害者开始依次尝试其余所有线程，
+     * 先窃取其双端队列顶部（最旧的任务），再尝试其收件箱。
+     * 从收件箱 / 共享队列取走任务后唤醒一个等待空位的外部生产者
+     * （本地双端队列只由本线程提交，无需通知）
+     */
+    bool FindLocalTask(size_t index, Worker& self, uint64_t& seed, std::optional<Task>& task) {
+        if (self.deque.TryPop(task) == RingQueueResult::Ok) return true;
+        if (self.inbox.TryPop(task) == RingQueueResult::Ok || _executor.TryPop(task)) {
+            _space.NotifyOne();
+            return true;
+        }
+
+        size_t n = _workers.size();
+        if (n <= 1) return false;
+
+        // xorshift64：每线程独立的廉价随机数
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        size_t start = static_cast<size_t>(seed % n);
+
+        for (size_t i = 0; i < n; ++i) {
+            size_t victim = (start + i) % n;
+            if (victim == index) continue;
+
+            Worker& other = *_workers[victim];
+            if (other.deque.TrySteal(task) == RingQueueResult::Ok) {
+                _metrics.Worker(index).AddSteal();
+                return true;
+            }
+            if (other.inbox.TryPop(task) == RingQueueResult::Ok) {
+                _metrics.Worker(index).AddSteal();
+                _space.NotifyOne();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 通道编号 → 共享队列（通道 0 为构造时传入的 executor）
+     */
+    LockFreeExecutor<Task>& Lane(size_t lane) {
+        return lane == 0 ? _executor : *_lanes[lane - 1];
+    }
+
+    /**
+     * @brief 超出范围的通道编号归入优先级最低的通道
+     */
+    size_t ClampLane(size_t lane) const {
+        return lane < LaneCount() ? lane : _lanes.size();
+    }
+
+    /**
+     * @brief 所有通道共享队列的任务数之和（近似值）
+     */
+    size_t LanesSizeApprox() const {
+        size_t size = _executor.SizeApprox();
+        for (const auto& lane : _lanes) {
+            size += lane->SizeApprox();
+        }
+        return size;
+    }
+
+    /**
+     * @brief 单次提交尝试：打入队时间戳、入队、唤醒一个工作线程
+     *
+     * @details
+     * 运行检查与入队之间登记在 _inFlight 中，Stop() 等待其归零后才返回，
+     * 因此不会有任务在 Stop() 之后落入无人消费的队列
+     *
+     * @return Enqueue 的结果；Runtime 未运行时为 Full（不会再有空位）；仅 Ok 时消耗 task
+     */
+    template<typename U>
+    RingQueueResult Offer(U&& task, size_t lane = 0) {
+        if constexpr (kMetricsEnabled && HasEnqueueTime<Task>::value &&
+                      std::is_const_v<std::remove_reference_t<U>>) {
+            Task copy(task);
+            return Offer(std::move(copy), lane);
+        } else {
+            InFlightGuard guard(_inFlight);
+            if (!_running.load(std::memory_order_seq_cst))
+                return RingQueueResult::Full;
+
+            MetricsStampEnqueue(task);
+            RingQueueResult r = Enqueue(std::forward<U>(task), lane);
+            if (r == RingQueueResult::Ok) {
+                _parking.NotifyOne();
+            }
+            return r;
+        }
+    }
+
+    /**
+     * @brief 等待空位直到入队或 deadline（见 Submit / SubmitFor）
+     */
+    template<typename U>
+    bool SubmitUntil(U&& task, std::optional<std::chrono::steady_clock::time_point> deadline, size_t lane = 0) {
+        if (_tlsOwner == this) {
+            OfferOrRun(std::forward<U>(task), lane);
+            return true;
+        }
+        return SubmitWithBackpressure(
+            _space,
+            [&] { return Offer(std::forward<U>(task), lane); },
+            [&] { return _running.load(std::memory_order_acquire); },
+            deadline);
+    }
+
+    /**
+     * @brief 入队，队列满时在当前线程执行（见 SubmitOrRun）
+     */
+    template<typename U>
+    bool OfferOrRun(U&& task, size_t lane = 0) {
+        RingQueueResult r;
+        while ((r = Offer(std::forward<U>(task), lane)) == RingQueueResult::Busy) {
+            CpuRelax();
+        }
+        if (r == RingQueueResult::Ok) return true;
+
+        if constexpr (std::is_const_v<std::remove_reference_t<U>>) {
+            Task copy(task);
+            copy();
+        } else {
+            task();
+        }
+        return false;
+    }
+
+    /**
+     * @brief 将任务放入合适的队列
+     *
+     * @details
+     * 各级 TryPush 仅在成功时才会移动 task，
+     * 因此失败后可安全地将同一个 task 转交给下一级队列；
+     * 只有最终结果计入指标（本地队列满而转投共享队列不算拒绝）；
+     * 低优先级通道（lane > 0）直接进入该通道的共享队列
+     *
+     * @return 共享队列的结果（本地队列 / 收件箱成功时为 Ok）
+     */
+    template<typename U>
+    RingQueueResult Enqueue(U&& task, size_t lane = 0) {
+        if (lane == 0 && _mode == ThreadExecutorMode::WorkStealing && !_workers.empty()) {
+            bool ok;
+            if (_tlsOwner == this) {
+                ok = _workers[_tlsIndex]->deque.TryPush(std::forward<U>(task)) == RingQueueResult::Ok;
             } else {
-                std::unique_lock<std::mutex> lock(_waitMutex);
-                _cv.wait_for(lock, std::chrono::milliseconds(1));
+                Worker& target = *_workers[_tlsRoundRobin++ % _workers.size()];
+                ok = target.inbox.TryPush(std::forward<U>(task)) == RingQueueResult::Ok;
+            }
+            if (ok) {
+                _metrics.AddSubmitted();
+                return RingQueueResult::Ok;
             }
         }
+        RingQueueResult r = Lane(lane).TryAdd(std::forward<U>(task));
+        if (r != RingQueueResult::Ok) {
+            _metrics.AddRejected(r);
+            return r;
+        }
+        _metrics.AddSubmitted();
+        return RingQueueResult::Ok;
     }
 
+private:
+    static constexpr size_t kBatchSize = 16; ///< 每次唤醒最多取出的任务数
+    static constexpr size_t kSpinCount = 64; ///< 停车前的自旋次数
+
+    static inline thread_local ThreadExecutor* _tlsOwner = nullptr; ///< 当前线程所属的 Runtime
+    static inline thread_local size_t _tlsIndex = 0;                ///< 当前线程的工作线程编号
+    static inline thread_local size_t _tlsRoundRobin =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()); ///< 外部提交的轮转游标（按线程错开起点）
+
 private:
     LockFreeExecutor<Task>& _executor; ///< Executor 层（任务容器）
     std::atomic<bool> _running;        ///< Runtime 运行状态
+    ThreadExecutorMode _mode;          ///< 任务分发模式
 
     std::vector<std::thread> _threads; ///< 工作线程集合
+    ThreadConfig _threadConfig;        ///< 工作线程放置与命名
+    std::vector<std::unique_ptr<Worker>> _workers; ///< 工作线程本地队列（WorkStealing）
+
+    std::vector<std::unique_ptr<LockFreeExecutor<Task>>> _lanes; ///< 低优先级通道 1..N-1
+    std::vector<uint32_t> _laneWeights; ///< 各通道每轮的取出份额（空为严格优先级）
+
+    EventCount _parking; ///< 线程停车/唤醒（仅在有线程睡眠时才产生系统调用）
+    EventCount _space;   ///< 等待队列空位的生产者停车/唤醒（Submit / SubmitFor）
+
+    alignas(kCacheLineSize) std::atomic<size_t> _inFlight{0}; ///< 已通过运行检查、尚未完成入队的提交数
 
-    std::condition_variable _cv; ///< 线程等待/唤醒
-    std::mutex _waitMutex;
+    ExecutorMetrics _metrics; ///< 运行指标（EXECUTOR_METRICS 关闭时为空实现）
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <Executor/BlockingTask.h>
 #include <Executor/ThreadExecutor.h>
 
@@ -9,21 +10,31 @@
  *
  * @details
  * - Submit() 会阻塞直到任务执行完成
+ * - 队列满时由 ThreadExecutor::Submit 等待空位，任务不会被丢弃
+ * - Runtime 已停止、无法入队时在调用线程执行
  * - 不修改 ThreadExecutor 本身
  *
+ * @tparam Task ThreadExecutor 的任务类型，需可由 void() 可调用对象构造
+ *
  * @author BUG
  */
+template<typename Task = std::function<void()>>
 class ThreadExecutorBlocking {
 public:
-    explicit ThreadExecutorBlocking(ThreadExecutor& exec)
+    explicit ThreadExecutorBlocking(ThreadExecutor<Task>& exec)
         : _exec(exec) {}
 
+    /**
+     * @brief 提交并等待执行完成
+     * @note 不可在该 ThreadExecutor 的工作线程内调用，否则可能自锁
+     */
     void Submit(std::function<void()> fn) {
         BlockingTask task(std::move(fn));
-        _exec.Add(std::ref(task));
+        if (!_exec.Submit(Task([&task] { task(); })))
+            task();
         task.Wait();
     }
 
 private:
-    ThreadExecutor& _exec;
+    ThreadExecutor<Task>& _exec;
 };
@@ -1,28 +1,66 @@
 #pragma once
 
-#include <Executor/ResultTask.h>
+#include <functional>
+#include <Executor/Future.h>
 #include <Executor/ThreadExecutor.h>
 
 /**
  * @class ThreadExecutorResult
  * @brief 基于 ThreadExecutor 的返回结果提交语义
  *
+ * @details
+ * - SubmitAsync() 不等待任务执行，立即返回 Future<R>（队列满时先等待空位）
+ * - Future::Then() 的续体同样投递到该 ThreadExecutor 上执行
+ * - Submit() 为阻塞版本：队列满时等待空位（ThreadExecutor::Submit），执行完成后返回结果
+ *
  * @tparam R 返回值类型
+ * @tparam Task ThreadExecutor 的任务类型，需可由 std::function<void()> 构造
  *
  * @author BUG
  */
-template<typename R>
+template<typename R, typename Task = std::function<void()>>
 class ThreadExecutorResult {
 public:
-    explicit ThreadExecutorResult(ThreadExecutor& exec)
+    explicit ThreadExecutorResult(ThreadExecutor<Task>& exec)
         : _exec(exec) {}
 
+    /**
+     * @brief 提交并立即返回结果 Future（不等待任务执行）
+     *
+     * @details
+     * - 队列满时按 ThreadExecutor::Submit 的背压语义等待空位（工作线程内调用时直接执行）
+     * - Runtime 未运行时在调用线程执行
+     * - fn 抛出的异常保存在 Future 中，Get() 时重新抛出
+     *
+     * @return 总是 Valid() 的 Future
+     */
+    Future<R> SubmitAsync(std::function<R()> fn) {
+        auto [promise, future] = MakePromise<R>(FutureExecutor::From(_exec));
+        Task task{std::function<void()>(
+            [p = std::move(promise), fn = std::move(fn)]() mutable {
+                p.SetValueFrom(fn);
+            })};
+        if (!_exec.Submit(std::move(task)))
+            task();
+        return std::move(future);
+    }
+
+    /**
+     * @brief 阻塞提交，直到取得结果
+     * @note 不可在该 ThreadExecutor 的工作线程内调用，否则可能自锁
+     */
     R Submit(std::function<R()> fn) {
-        ResultTask<R> task(std::move(fn));
-        _exec.Add(std::ref(task));
-        return task.Get();
+        auto [promise, future] = MakePromise<R>(FutureExecutor::From(_exec));
+        Task task{std::function<void()>(
+            [p = std::move(promise), fn = std::move(fn)]() mutable {
+                p.SetValueFrom(fn);
+            })};
+        // 队列满时在 Submit 内等待空位；Runtime 未运行时 Submit 拒绝，在调用线程执行
+        if (!_exec.Submit(std::move(task)))
+            task();
+        return future.Get();
     }
 
 private:
-    ThreadExecutor& _exec;
+    ThreadExecutor<Task>& _exec;
 };
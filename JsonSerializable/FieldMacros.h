@@ -1,22 +1,31 @@
 #pragma once
 
 #include <optional>
+#include <type_traits>
 #include <map>
 #include <unordered_map>
+#include <memory_resource>
+#include "JsonSerializable/JsonDirtyState.hpp"
 
 /**
  * 字段定义宏
  * 用于简化类的字段定义和访问器生成
  */
 
+// 记录字段被修改（类未声明 JSON_DIRTY_TRACKING 时为空操作）
+#ifndef JSON_MARK_DIRTY_
+#define JSON_MARK_DIRTY_(NAME) \
+    JsonMarkDirty(*this, &std::remove_pointer_t<decltype(this)>::_##NAME)
+#endif
+
 // 基础字段定义宏
 #ifndef FIELD
 #define FIELD(TYPE, NAME) \
 private: std::optional<TYPE> _##NAME; \
 public: \
     const std::optional<TYPE>& get_##NAME() const { return _##NAME; } \
-    void set_##NAME(const TYPE& value) { _##NAME = value; } \
-    void reset_##NAME() { _##NAME.reset(); }
+    void set_##NAME(const TYPE& value) { _##NAME = value; JSON_MARK_DIRTY_(NAME); } \
+    void reset_##NAME() { _##NAME.reset(); JSON_MARK_DIRTY_(NAME); }
 #endif
 
 // 有序映射字段定义宏
@@ -25,8 +34,8 @@ public: \
 private: std::optional<std::map<KEY_TYPE, VALUE_TYPE>> _##NAME; \
 public: \
     const std::optional<std::map<KEY_TYPE, VALUE_TYPE>>& get_##NAME() const { return _##NAME; } \
-    void set_##NAME(const std::map<KEY_TYPE, VALUE_TYPE>& value) { _##NAME = value; } \
-    void reset_##NAME() { _##NAME.reset(); }
+    void set_##NAME(const std::map<KEY_TYPE, VALUE_TYPE>& value) { _##NAME = value; JSON_MARK_DIRTY_(NAME); } \
+    void reset_##NAME() { _##NAME.reset(); JSON_MARK_DIRTY_(NAME); }
 #endif
 
 // 无序映射字段定义宏
@@ -35,11 +44,32 @@ public: \
 private: std::optional<std::unordered_map<KEY_TYPE, VALUE_TYPE>> _##NAME; \
 public: \
     const std::optional<std::unordered_map<KEY_TYPE, VALUE_TYPE>>& get_##NAME() const { return _##NAME; } \
-    void set_##NAME(const std::unordered_map<KEY_TYPE, VALUE_TYPE>& value) { _##NAME = value; } \
-    void reset_##NAME() { _##NAME.reset(); }
+    void set_##NAME(const std::unordered_map<KEY_TYPE, VALUE_TYPE>& value) { _##NAME = value; JSON_MARK_DIRTY_(NAME); } \
+    void reset_##NAME() { _##NAME.reset(); JSON_MARK_DIRTY_(NAME); }
+#endif
+
+// std::pmr 有序映射字段定义宏（反序列化时从当前内存资源分配，见 JsonMemoryResource.hpp）
+#ifndef FIELD_PMR_MAP
+#define FIELD_PMR_MAP(KEY_TYPE, VALUE_TYPE, NAME) \
+private: std::optional<std::pmr::map<KEY_TYPE, VALUE_TYPE>> _##NAME; \
+public: \
+    const std::optional<std::pmr::map<KEY_TYPE, VALUE_TYPE>>& get_##NAME() const { return _##NAME; } \
+    void set_##NAME(const std::pmr::map<KEY_TYPE, VALUE_TYPE>& value) { _##NAME = value; JSON_MARK_DIRTY_(NAME); } \
+    void reset_##NAME() { _##NAME.reset(); JSON_MARK_DIRTY_(NAME); }
+#endif
+
+// std::pmr 无序映射字段定义宏
+#ifndef FIELD_PMR_UNORDERED_MAP
+#define FIELD_PMR_UNORDERED_MAP(KEY_TYPE, VALUE_TYPE, NAME) \
+private: std::optional<std::pmr::unordered_map<KEY_TYPE, VALUE_TYPE>> _##NAME; \
+public: \
+    const std::optional<std::pmr::unordered_map<KEY_TYPE, VALUE_TYPE>>& get_##NAME() const { return _##NAME; } \
+    void set_##NAME(const std::pmr::unordered_map<KEY_TYPE, VALUE_TYPE>& value) { _##NAME = value; JSON_MARK_DIRTY_(NAME); } \
+    void reset_##NAME() { _##NAME.reset(); JSON_MARK_DIRTY_(NAME); }
 #endif
 
-// 字段对宏（用于序列化/反序列化参数传递）
+// 字段对宏（用于序列化/反序列化参数传递）：字段名字面量 + 成员指针
+// 只能写在 JSON_* 宏的字段列表内：JsonSelf_ 为 JSON_FIELDS_ 生成的字段表模板参数（即本类）
 #ifndef FIELD_PAIR
-#define FIELD_PAIR(NAME) #NAME, &_##NAME
+#define FIELD_PAIR(NAME) #NAME, &JsonSelf_::_##NAME
 #endif
\ No newline at end of file
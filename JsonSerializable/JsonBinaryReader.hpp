@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <jsoncpp/json/json.h>
+#if __has_include(<span>)
+#include <span>
+#endif
+#include "JsonSerializable/TypeTraits.h"
+#include "JsonSerializable/JsonBinaryWriter.hpp"
+
+/**
+ * @brief 紧凑二进制读取器
+ * @details 在输入字节上顺序前进，编码见 JsonBinaryWriter。
+ * - 字符串直接返回指向输入的 std::string_view（零拷贝），输入在读取期间必须保持有效
+ * - 任何截断、越界或类型不符都会使读取器进入失败状态（Ok() 为 false），之后的操作全部返回 false
+ * - 长度与元素数在分配前按剩余字节数校验，畸形输入不会触发超大分配
+ */
+class JsonBinaryReader {
+public:
+    /// 嵌套深度上限（防止恶意输入耗尽栈）
+    static constexpr size_t kMaxDepth = 512;
+
+    JsonBinaryReader(const std::byte* data, size_t size)
+        : _begin(data), _p(data), _end(data + size)
+    {}
+
+    explicit JsonBinaryReader(const std::vector<std::byte>& data)
+        : JsonBinaryReader(data.data(), data.size())
+    {}
+
+#if defined(__cpp_lib_span)
+    explicit JsonBinaryReader(std::span<const std::byte> data)
+        : JsonBinaryReader(data.data(), data.size())
+    {}
+#endif
+
+    bool Ok() const { return !_failed; }
+
+    /**
+     * @brief 出错位置（相对输入起点的字节偏移）
+     */
+    size_t ErrorOffset() const { return _errorAt; }
+
+    /**
+     * @brief 输入是否已全部消耗
+     */
+    bool AtEnd() const { return !_failed && _p == _end; }
+
+    size_t Remaining() const { return static_cast<size_t>(_end - _p); }
+
+    /**
+     * @brief 主动标记失败
+     * @return 恒为 false
+     */
+    bool Fail() {
+        if (!_failed) {
+            _failed = true;
+            _errorAt = static_cast<size_t>(_p - _begin);
+        }
+        return false;
+    }
+
+    /**
+     * @brief 进入一层嵌套（对象、容器），超过 kMaxDepth 时失败
+     * @details 成功后须以 Ascend() 配对
+     */
+    bool Descend() {
+        if (_failed) return false;
+        if (_depth >= kMaxDepth) return Fail();
+        ++_depth;
+        return true;
+    }
+
+    void Ascend() {
+        --_depth;
+    }
+
+    bool Varint(uint64_t& value) {
+        if (_failed) return false;
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (_p == _end) return Fail();
+            uint64_t byte = static_cast<uint8_t>(*_p++);
+            if (shift == 63 && byte > 1) return Fail();
+            value |= (byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return Fail();
+    }
+
+    /**
+     * @brief 读取不超过 minBytes 字节单位可容纳的元素数（varint）
+     * @param minBytes 每个元素至少占用的字节数，用于在分配前拒绝不可能的计数
+     */
+    bool Count(size_t& count, size_t minBytes = 1) {
+        uint64_t n = 0;
+        if (!Varint(n)) return false;
+        if (minBytes != 0 && n > Remaining() / minBytes) return Fail();
+        count = static_cast<size_t>(n);
+        return true;
+    }
+
+    /**
+     * @brief 取出接下来的 size 个字节（零拷贝）
+     */
+    bool Bytes(const std::byte*& data, size_t size) {
+        if (_failed) return false;
+        if (size > Remaining()) return Fail();
+        data = _p;
+        _p += size;
+        return true;
+    }
+
+    /**
+     * @brief 读取字符串
+     * @param out 指向输入缓冲区
+     */
+    bool ReadString(std::string_view& out) {
+        size_t size = 0;
+        const std::byte* data = nullptr;
+        if (!Count(size) || !Bytes(data, size)) return false;
+        out = std::string_view(reinterpret_cast<const char*>(data), size);
+        return true;
+    }
+
+    /**
+     * @brief 读取标量
+     * @tparam T bool、整数、浮点或字符串（std::string / std::pmr::string）
+     */
+    template<typename T>
+    bool Read(T& out) {
+        if constexpr (std::is_same_v<T, bool>) {
+            const std::byte* data = nullptr;
+            if (!Bytes(data, 1)) return false;
+            uint8_t b = static_cast<uint8_t>(*data);
+            if (b > 1) return Fail();
+            out = (b == 1);
+            return true;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            static_assert(sizeof(T) == sizeof(Bits), "JsonBinaryReader: unsupported floating point type");
+            const std::byte* data = nullptr;
+            if (!Bytes(data, sizeof(Bits))) return false;
+            Bits bits = 0;
+            for (size_t i = 0; i < sizeof(Bits); ++i) {
+                bits |= static_cast<Bits>(static_cast<uint8_t>(data[i])) << (8 * i);
+            }
+            std::memcpy(&out, &bits, sizeof(bits));
+            return true;
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            uint64_t raw = 0;
+            if (!Varint(raw)) return false;
+            int64_t v = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+            if (v < static_cast<int64_t>(std::numeric_limits<T>::lowest()) ||
+                v > static_cast<int64_t>(std::numeric_limits<T>::max())) {
+                return Fail();
+            }
+            out = static_cast<T>(v);
+            return true;
+        } else if constexpr (std::is_integral_v<T>) {
+            uint64_t v = 0;
+            if (!Varint(v)) return false;
+            if (v > static_cast<uint64_t>(std::numeric_limits<T>::max())) return Fail();
+            out = static_cast<T>(v);
+            return true;
+        } else if constexpr (is_string<T>::value) {
+            std::string_view s;
+            if (!ReadString(s)) return false;
+            out.assign(s.data(), s.size());
+            return true;
+        } else {
+            static_assert(std::is_same_v<T, bool>, "JsonBinaryReader::Read: unsupported type");
+            return false;
+        }
+    }
+
+    /**
+     * @brief 读取一个自描述的 Json::Value（JsonBinaryWriter::Value(const Json::Value&) 的逆过程）
+     */
+    bool Read(Json::Value& out) {
+        const std::byte* data = nullptr;
+        if (!Bytes(data, 1)) return false;
+        switch (static_cast<JsonBinaryTag>(*data)) {
+            case JsonBinaryTag::Null:
+                out = Json::Value();
+                return true;
+            case JsonBinaryTag::False:
+            case JsonBinaryTag::True:
+                out = (static_cast<JsonBinaryTag>(*data) == JsonBinaryTag::True);
+                return true;
+            case JsonBinaryTag::Int: {
+                int64_t v = 0;
+                if (!Read(v)) return false;
+                out = static_cast<Json::LargestInt>(v);
+                return true;
+            }
+            case JsonBinaryTag::UInt: {
+                uint64_t v = 0;
+                if (!Read(v)) return false;
+                out = static_cast<Json::LargestUInt>(v);
+                return true;
+            }
+            case JsonBinaryTag::Double: {
+                double v = 0;
+                if (!Read(v)) return false;
+                out = v;
+                return true;
+            }
+            case JsonBinaryTag::String: {
+                std::string_view s;
+                if (!ReadString(s)) return false;
+                out = Json::Value(s.data(), s.data() + s.size());
+                return true;
+            }
+            case JsonBinaryTag::Array: {
+                size_t count = 0;
+                if (!Count(count)) return false;
+                out = Json::Value(Json::arrayValue);
+                if (!Descend()) return false;
+                for (size_t i = 0; i < count; ++i) {
+                    if (!Read(out.append(Json::Value()))) break;
+                }
+                Ascend();
+                return Ok();
+            }
+            case JsonBinaryTag::Object: {
+                size_t count = 0;
+                if (!Count(count, 2)) return false;
+                out = Json::Value(Json::objectValue);
+                if (!Descend()) return false;
+                for (size_t i = 0; i < count; ++i) {
+                    std::string_view key;
+                    if (!ReadString(key)) break;
+                    if (!Read(out[std::string(key)])) break;
+                }
+                Ascend();
+                return Ok();
+            }
+            default:
+                --_p;
+                return Fail();
+        }
+    }
+
+private:
+    const std::byte* _begin;
+    const std::byte* _p;
+    const std::byte* _end;
+    size_t _depth = 0;
+    size_t _errorAt = 0;
+    bool _failed = false;
+};
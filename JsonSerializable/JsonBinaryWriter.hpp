@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <jsoncpp/json/json.h>
+
+/**
+ * @brief 紧凑二进制编码的值标签（仅用于 Json::Value 回退路径）
+ */
+enum class JsonBinaryTag : uint8_t {
+    Null   = 0,
+    False  = 1,
+    True   = 2,
+    Int    = 3,   ///< zigzag varint
+    UInt   = 4,   ///< varint
+    Double = 5,   ///< 8 字节小端 IEEE-754
+    String = 6,   ///< varint 长度 + 字节
+    Array  = 7,   ///< varint 元素数 + 元素
+    Object = 8,   ///< varint 成员数 + (字符串键, 值)
+};
+
+/**
+ * @brief 紧凑二进制写入器
+ * @details 把由 FIELD_PAIR 列表驱动的二进制编码追加到调用者提供的缓冲区。
+ * 编码由类结构决定，不带字段名：
+ * - 对象的每一层（JSON_SERIALIZE_*_INHERIT 先父类后子类）写一个块：
+ *   varint 字段数 + 存在位图（ceil(字段数 / 8) 字节，第 i 位对应第 i 个 FIELD_PAIR）+ 依次写出已设置的字段
+ * - bool 1 字节；无符号整数 varint；有符号整数 zigzag varint；float / double 4 / 8 字节小端
+ * - 字符串：varint 长度 + 字节；序列 / 集合：varint 元素数 + 元素；映射：varint 条目数 + (键, 值)
+ * - 只实现了 to_json() 的类型与 Json::Value 字段按 JsonBinaryTag 写成自描述的值
+ *
+ * 读取见 JsonBinaryReader.hpp。
+ */
+class JsonBinaryWriter {
+public:
+    explicit JsonBinaryWriter(std::vector<std::byte>& out) : _out(out) {}
+
+    /**
+     * @brief 底层输出缓冲区
+     */
+    std::vector<std::byte>& Buffer() { return _out; }
+
+    void Varint(uint64_t value) {
+        while (value >= 0x80) {
+            _out.push_back(static_cast<std::byte>(value | 0x80));
+            value >>= 7;
+        }
+        _out.push_back(static_cast<std::byte>(value));
+    }
+
+    void Bytes(const void* data, size_t size) {
+        const std::byte* p = static_cast<const std::byte*>(data);
+        _out.insert(_out.end(), p, p + size);
+    }
+
+    /**
+     * @brief 追加 size 个 0 字节（如存在位图），返回其起始偏移
+     */
+    size_t Reserve(size_t size) {
+        size_t offset = _out.size();
+        _out.resize(offset + size);
+        return offset;
+    }
+
+    /**
+     * @brief 置位 Reserve() 得到的位图中的第 index 位
+     */
+    void SetBit(size_t offset, size_t index) {
+        _out[offset + index / 8] |= static_cast<std::byte>(1u << (index % 8));
+    }
+
+    /**
+     * @brief 写入标量值
+     * @tparam T bool、整数、浮点或可转换为 std::string_view 的字符串类型
+     */
+    template<typename T>
+    void Value(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            _out.push_back(static_cast<std::byte>(value ? 1 : 0));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            static_assert(sizeof(T) == sizeof(Bits), "JsonBinaryWriter: unsupported floating point type");
+            Bits bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            for (size_t i = 0; i < sizeof(bits); ++i) {
+                _out.push_back(static_cast<std::byte>(bits >> (8 * i)));
+            }
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            int64_t v = value;
+            Varint((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+        } else if constexpr (std::is_integral_v<T>) {
+            Varint(static_cast<uint64_t>(value));
+        } else {
+            std::string_view s(value);
+            Varint(s.size());
+            Bytes(s.data(), s.size());
+        }
+    }
+
+    /**
+     * @brief 以自描述形式写入一棵 Json::Value（兼容手写 to_json() 的类型）
+     */
+    void Value(const Json::Value& value) {
+        switch (value.type()) {
+            case Json::nullValue:
+                Tag(JsonBinaryTag::Null);
+                break;
+            case Json::intValue:
+                Tag(JsonBinaryTag::Int);
+                Value(static_cast<int64_t>(value.asLargestInt()));
+                break;
+            case Json::uintValue:
+                Tag(JsonBinaryTag::UInt);
+                Value(static_cast<uint64_t>(value.asLargestUInt()));
+                break;
+            case Json::realValue:
+                Tag(JsonBinaryTag::Double);
+                Value(value.asDouble());
+                break;
+            case Json::booleanValue:
+                Tag(value.asBool() ? JsonBinaryTag::True : JsonBinaryTag::False);
+                break;
+            case Json::stringValue: {
+                const char* begin = nullptr;
+                const char* end = nullptr;
+                value.getString(&begin, &end);
+                Tag(JsonBinaryTag::String);
+                Value(std::string_view(begin, static_cast<size_t>(end - begin)));
+                break;
+            }
+            case Json::arrayValue:
+                Tag(JsonBinaryTag::Array);
+                Varint(value.size());
+                for (const auto& item : value) Value(item);
+                break;
+            case Json::objectValue:
+                Tag(JsonBinaryTag::Object);
+                Varint(value.size());
+                for (auto it = value.begin(); it != value.end(); ++it) {
+                    const char* end = nullptr;
+                    const char* begin = it.memberName(&end);
+                    Value(std::string_view(begin, static_cast<size_t>(end - begin)));
+                    Value(*it);
+                }
+                break;
+        }
+    }
+
+private:
+    void Tag(JsonBinaryTag tag) {
+        _out.push_back(static_cast<std::byte>(tag));
+    }
+
+    std::vector<std::byte>& _out;
+};
@@ -12,8 +12,21 @@
 #include <iostream>
 #include <jsoncpp/json/json.h>
 #include <type_traits>
+#include <string_view>
+#include <charconv>
+#include <atomic>
+#include <cstddef>
+#if __has_include(<span>)
+#include <span>
+#endif
 #include "JsonSerializable/TypeTraits.h"
+#include "JsonSerializable/JsonReader.hpp"
+#include "JsonSerializable/JsonBinaryReader.hpp"
+#include "JsonSerializable/JsonMemoryResource.hpp"
+#include "JsonSerializable/JsonParallel.hpp"
 #include "JsonSerializable/FieldMacros.h"
+#include "JsonSerializable/JsonFieldList.hpp"
+#include "JsonSerializable/JsonDirtyState.hpp"
 
 /**
  * @brief JSON 反序列化基类
@@ -22,6 +35,9 @@
  * 1. 继承 JsonDeserializer。
  * 2. 重载 from_json() 或使用宏自动生成反序列化函数。
  * 3. 调用 from_json() 或静态方法 from_json() / from_json_array() 获取对象或对象数组。
+ *
+ * 流式路径：JSON_DESERIALIZE* 宏同时生成 from_json(JsonReader&)，
+ * 由 read_json() / from_json_string() / from_json_array_string() 直接从文本一次遍历填充字段，不构建 Json::Value。
  */
 class JsonDeserializer {
 public:
@@ -33,116 +49,564 @@ public:
      */
     virtual void from_json(const Json::Value&) {}
 
+    /**
+     * @brief 从 JsonReader 的下一个值初始化当前对象
+     * @param r 读取器
+     * @return 是否成功（失败时 r.Ok() 为 false）
+     * @details 宏生成的类按字段表直接填充；只重载了 from_json(const Json::Value&) 的类经 DOM 回退
+     */
+    virtual bool from_json(JsonReader& r) {
+        Json::Value j;
+        if (!r.Read(j)) return false;
+        from_json(j);
+        return true;
+    }
+
+    /**
+     * @brief 读取一个字段的值
+     * @param r 读取器，位于该字段的值之前
+     * @param key 字段名
+     * @return false 表示不是本类的字段（未消耗任何输入）
+     */
+    virtual bool from_json_field(JsonReader&, std::string_view) { return false; }
+
+    /**
+     * @brief 从 JSON 文本初始化当前对象
+     * @param json 完整的 JSON 文本
+     * @return 文本合法且完整消耗时返回 true
+     */
+    bool read_json(std::string_view json) {
+        JsonReader r(json);
+        return from_json(r) && r.AtEnd();
+    }
+
+    /**
+     * @brief 从 JSON 文本初始化当前对象，新建的 std::pmr 字段从 resource 分配
+     * @param json 完整的 JSON 文本
+     * @param resource 内存资源（如 std::pmr::monotonic_buffer_resource），须长于本对象
+     */
+    bool read_json(std::string_view json, std::pmr::memory_resource* resource) {
+        JsonMemoryResourceScope scope(resource);
+        return read_json(json);
+    }
+
+    /**
+     * @brief 应用 JsonSerializer::to_json_delta() 生成的增量
+     * @param json 增量 JSON 对象：出现的字段被覆盖，值为 null 的字段被重置，其余字段不变
+     * @return 文本合法且完整消耗时返回 true
+     */
+    bool apply_json_delta(std::string_view json) {
+        JsonReader r(json);
+        r.SetNullResetsFields(true);
+        return from_json(r) && r.AtEnd();
+    }
+
+    /**
+     * @brief 从紧凑二进制编码初始化当前对象
+     * @param r 读取器
+     * @return 是否成功
+     * @details 宏生成的类按 FIELD_PAIR 列表读取字段块；只实现了 from_json(const Json::Value&) 的类
+     * 读取自描述的 Json::Value 后经 DOM 填充（与 JsonSerializer::to_binary 的默认实现对应）
+     */
+    virtual bool from_binary(JsonBinaryReader& r) {
+        Json::Value j;
+        if (!r.Read(j)) return false;
+        from_json(j);
+        return true;
+    }
+
+    /**
+     * @brief 从完整的二进制编码初始化当前对象
+     * @return 编码合法且完整消耗时返回 true
+     */
+    bool read_binary(const std::byte* data, size_t size) {
+        JsonBinaryReader r(data, size);
+        return from_binary(r) && r.AtEnd();
+    }
+
+    bool read_binary(const std::vector<std::byte>& data) {
+        return read_binary(data.data(), data.size());
+    }
+
+#if defined(__cpp_lib_span)
+    bool read_binary(std::span<const std::byte> data) {
+        return read_binary(data.data(), data.size());
+    }
+#endif
+
     // ========================= 可选类型反序列化 =========================
 
     /**
-     * @brief 将多个可选字段从 JSON 对象中反序列化
-     * @tparam T 第一个字段类型
-     * @tparam Args 其他字段类型
+     * @brief 从 JSON 对象中反序列化字段表中的字段
+     * @tparam Self 字段所属对象类型
+     * @tparam Fields 字段描述类型
      * @param j JSON 对象引用
-     * @param name 当前字段名称
-     * @param value 当前字段的可选值指针
-     * @param args 其他字段参数包
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     * @details 每个字段一次 find 定位成员；值在 optional 内原地构造并填充，不经过临时对象。
+     * 声明了 JSON_DIRTY_TRACKING 的类把读到的字段记为已修改（下同）
      */
+    template<typename Self, typename... Fields>
+    void from_json(const Json::Value& j, Self& self, const JsonFieldList<Fields...>& fields) {
+        if (!j.isObject()) return;
+        fields.ForEach([&](const auto& field) {
+            const Json::Value* member = j.find(field.name.data(), field.name.data() + field.name.size());
+            if (member == nullptr) return;
+            from_json_value(*member, emplace_json_value(self.*field.member));
+            JsonMarkDirty(self, field.member);
+        });
+    }
+
+    /**
+     * @brief 旧接口：按 (字段名, 字段指针, ...) 参数包从 JSON 对象反序列化
+     * @deprecated FIELD_PAIR 已改为成员指针，JSON_* 宏改用上面的字段表版本；
+     * 手写的 from_json(j, "id", &_id, ...) 调用仍可编译，建议改用 JSON_DESERIALIZE* 宏
+     */
+    template<typename T, typename... Args>
+    [[deprecated("use the JSON_DESERIALIZE* macros (field-table from_json)")]]
+    void from_json(const Json::Value& j, std::string_view name, std::optional<T>* value, Args... args) {
+        if (!j.isObject()) return;
+        from_json_pairs(j, name, value, args...);
+    }
+
+private:
     template<typename T, typename... Args>
-    void from_json(const Json::Value& j, std::string name, std::optional<T>* value, Args... args) {
-        from_json(j, name, value);
-        from_json(j, args...);
+    void from_json_pairs(const Json::Value& j, std::string_view name, std::optional<T>* value, Args... args) {
+        const Json::Value* member = value != nullptr ? j.find(name.data(), name.data() + name.size()) : nullptr;
+        if (member != nullptr) from_json_value(*member, emplace_json_value(*value));
+        if constexpr (sizeof...(Args) > 0) from_json_pairs(j, args...);
     }
 
+public:
+
     /**
-     * @brief 将单个可选字段从 JSON 对象中反序列化
-     * @tparam T 字段类型
-     * @param j JSON 对象引用
-     * @param name 字段名称
-     * @param value 字段的可选值指针
+     * @brief 将 Json::Value 转换为任意支持类型
+     * @tparam T 类型
+     * @param v JSON 值
+     * @param out 目标，容器先按元素数 reserve，元素直接在容器内构造
+     * @details 无法转换为键类型的成员被跳过
      */
     template<typename T>
-    void from_json(const Json::Value& j, std::string name, std::optional<T>* value) {
-        if (value == nullptr || !j.isMember(name)) return;
-        
+    void from_json_value(const Json::Value& v, T& out) {
         if constexpr (std::is_base_of_v<JsonDeserializer, T>) {
-            T obj; 
-            obj.from_json(j[name]);
-            *value = obj;
+            static_cast<JsonDeserializer&>(out).from_json(v);
         } else if constexpr (is_sequence_container<T>::value) {
-            T container;
-            for (const auto& item : j[name]) {
-                typename T::value_type elem;
-                if constexpr (std::is_base_of_v<JsonDeserializer, typename T::value_type>) {
-                    elem.from_json(item);
-                } else {
-                    elem = item.as<typename T::value_type>();
-                }
-                container.push_back(elem);
+            if constexpr (has_reserve<T>::value) out.reserve(v.size());
+            for (const auto& item : v) {
+                emplace_json_back(out);
+                from_json_value(item, out.back());
             }
-            *value = container;
         } else if constexpr (is_set_container<T>::value) {
-            T container;
-            for (const auto& item : j[name]) {
-                typename T::value_type elem;
-                if constexpr (std::is_base_of_v<JsonDeserializer, typename T::value_type>) {
-                    elem.from_json(item);
-                } else {
-                    elem = item.as<typename T::value_type>();
-                }
-                container.insert(elem);
+            if constexpr (has_reserve<T>::value) out.reserve(v.size());
+            for (const auto& item : v) {
+                typename T::value_type elem = make_json_value<typename T::value_type>();
+                from_json_value(item, elem);
+                out.insert(std::move(elem));
             }
-            *value = container;
         } else if constexpr (is_associative_container<T>::value) {
-            T container;
-            for (const auto& key : j[name].getMemberNames()) {
-                typename T::key_type k = from_string<typename T::key_type>(key);
-                typename T::mapped_type v;
-                if constexpr (std::is_base_of_v<JsonDeserializer, typename T::mapped_type>) {
-                    v.from_json(j[name][key]);
+            if (!v.isObject()) return;
+            if constexpr (has_reserve<T>::value) out.reserve(v.size());
+            for (auto it = v.begin(); it != v.end(); ++it) {
+                const char* end = nullptr;
+                const char* begin = it.memberName(&end);
+                typename T::key_type k = make_json_value<typename T::key_type>();
+                if (!key_from_string(std::string_view(begin, static_cast<size_t>(end - begin)), k)) continue;
+                from_json_value(*it, emplace_json_mapped(out, std::move(k)));
+            }
+        } else if constexpr (is_string<T>::value && !std::is_same_v<T, std::string>) {
+            if (v.isString()) {
+                const char* begin = nullptr;
+                const char* end = nullptr;
+                v.getString(&begin, &end);
+                out.assign(begin, static_cast<size_t>(end - begin));
+            } else {
+                std::string text = v.asString();
+                out.assign(text.data(), text.size());
+            }
+        } else {
+            out = v.as<T>();
+        }
+    }
+
+    // ========================= 流式反序列化 =========================
+
+    /**
+     * @brief 读取一个对象，逐个键交给 from_json_field，未知字段跳过
+     * @param r 读取器
+     * @return 是否成功；值为 null 时保持对象不变并返回 true
+     */
+    bool read_json_object(JsonReader& r) {
+        if (r.ReadNull()) return true;
+        if (!r.BeginObject()) return false;
+        std::string_view key;
+        while (r.NextKey(key)) {
+            if (!from_json_field(r, key) && !r.Skip()) return false;
+        }
+        return r.Ok();
+    }
+
+    /**
+     * @brief 按字段名查找表定位 key 并读取对应字段
+     * @tparam Self 字段所属对象类型
+     * @tparam Fields 字段描述类型
+     * @param r 读取器
+     * @param key 字段名
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     * @param table 由同一字段表构造的名字查找表
+     * @return 是否命中
+     * @details 字段值为 null 时保持字段不变（r.NullResetsFields() 时重置字段）；读取失败时字段被重置
+     */
+    template<typename Self, typename... Fields>
+    bool from_json_field(JsonReader& r, std::string_view key, Self& self,
+                         const JsonFieldList<Fields...>& fields,
+                         const JsonFieldTable<sizeof...(Fields)>& table) {
+        int index = table.Find(key);
+        if (index < 0) return false;
+        fields.Visit(static_cast<size_t>(index), [&](const auto& field) {
+            auto& value = self.*field.member;
+            if (r.ReadNull()) {
+                if (!r.NullResetsFields()) return;
+                value.reset();
+            } else if (!read_json_value(r, emplace_json_value(value))) {
+                value.reset();
+            }
+            JsonMarkDirty(self, field.member);
+        });
+        return true;
+    }
+
+    /**
+     * @brief 从读取器读取任意支持类型
+     * @tparam T 类型
+     * @param r 读取器
+     * @param out 目标，容器元素直接在容器内构造
+     * @return 是否成功
+     */
+    template<typename T>
+    bool read_json_value(JsonReader& r, T& out) {
+        if constexpr (std::is_base_of_v<JsonDeserializer, T>) {
+            return static_cast<JsonDeserializer&>(out).from_json(r);
+        } else if constexpr (is_sequence_container<T>::value) {
+            if (!r.BeginArray()) return false;
+            while (r.NextElement()) {
+                emplace_json_back(out);
+                if (!read_json_value(r, out.back())) return false;
+            }
+            return r.Ok();
+        } else if constexpr (is_set_container<T>::value) {
+            if (!r.BeginArray()) return false;
+            while (r.NextElement()) {
+                typename T::value_type elem = make_json_value<typename T::value_type>();
+                if (!read_json_value(r, elem)) return false;
+                out.insert(std::move(elem));
+            }
+            return r.Ok();
+        } else if constexpr (is_associative_container<T>::value) {
+            if (!r.BeginObject()) return false;
+            std::string_view name;
+            while (r.NextKey(name)) {
+                typename T::key_type k = make_json_value<typename T::key_type>();
+                if (!key_from_string(name, k)) {
+                    if (!r.Skip()) return false;
+                    continue;
+                }
+                if (!read_json_value(r, emplace_json_mapped(out, std::move(k)))) return false;
+            }
+            return r.Ok();
+        } else {
+            return r.Read(out);
+        }
+    }
+
+    // ========================= 二进制反序列化 =========================
+
+    /**
+     * @brief 读取一层字段块（JsonSerializer::to_binary_fields 的逆过程）
+     * @tparam Self 字段所属对象类型
+     * @tparam Fields 字段描述类型
+     * @param r 读取器
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     * @return 是否成功；字段数与本类不符时失败；未设置的字段保持不变，读取失败的字段被重置
+     */
+    template<typename Self, typename... Fields>
+    bool from_binary_fields(JsonBinaryReader& r, Self& self, const JsonFieldList<Fields...>& fields) {
+        constexpr size_t count = JsonFieldList<Fields...>::size;
+        uint64_t encoded = 0;
+        if (!r.Varint(encoded)) return false;
+        if (encoded != count) return r.Fail();
+        const std::byte* bitmap = nullptr;
+        if (!r.Bytes(bitmap, (count + 7) / 8)) return false;
+        size_t index = 0;
+        return fields.All([&](const auto& field) {
+            size_t bit = index++;
+            if (((static_cast<uint8_t>(bitmap[bit / 8]) >> (bit % 8)) & 1) == 0) return true;
+            auto& value = self.*field.member;
+            JsonMarkDirty(self, field.member);
+            if (read_binary_value(r, emplace_json_value(value))) return true;
+            value.reset();
+            return false;
+        });
+    }
+
+    /**
+     * @brief 从二进制读取器读取任意支持类型
+     * @tparam T 类型
+     * @param r 读取器
+     * @param out 目标，容器先按元素数 reserve，元素直接在容器内构造
+     * @return 是否成功
+     */
+    template<typename T>
+    bool read_binary_value(JsonBinaryReader& r, T& out) {
+        if constexpr (std::is_base_of_v<JsonDeserializer, T>) {
+            if (!r.Descend()) return false;
+            bool ok = static_cast<JsonDeserializer&>(out).from_binary(r);
+            r.Ascend();
+            return ok;
+        } else if constexpr (is_sequence_container<T>::value || is_set_container<T>::value ||
+                             is_associative_container<T>::value) {
+            size_t count = 0;
+            if (!r.Count(count, is_associative_container<T>::value ? 2 : 1) || !r.Descend()) return false;
+            if constexpr (has_reserve<T>::value) out.reserve(count);
+            bool ok = true;
+            for (size_t i = 0; ok && i < count; ++i) {
+                if constexpr (is_sequence_container<T>::value) {
+                    emplace_json_back(out);
+                    ok = read_binary_value(r, out.back());
+                } else if constexpr (is_set_container<T>::value) {
+                    typename T::value_type elem = make_json_value<typename T::value_type>();
+                    ok = read_binary_value(r, elem);
+                    if (ok) out.insert(std::move(elem));
                 } else {
-                    v = j[name][key].as<typename T::mapped_type>();
+                    typename T::key_type k = make_json_value<typename T::key_type>();
+                    ok = read_binary_value(r, k) && read_binary_value(r, emplace_json_mapped(out, std::move(k)));
                 }
-                container[k] = v;
             }
-            *value = container;
+            r.Ascend();
+            return ok;
         } else {
-            *value = j[name].as<T>();
+            return r.Read(out);
+        }
+    }
+
+    /**
+     * @brief 把字符串形式的键转换为键类型（std::from_chars，不抛异常）
+     * @return 转换是否成功
+     */
+    template<typename K>
+    static bool key_from_string(std::string_view str, K& key) {
+        if constexpr (is_string<K>::value) {
+            key.assign(str.data(), str.size());
+            return true;
+        } else if constexpr (std::is_arithmetic_v<K> && !std::is_same_v<K, bool>) {
+            const char* last = str.data() + str.size();
+            auto r = std::from_chars(str.data(), last, key);
+            return r.ec == std::errc() && r.ptr == last;
+        } else {
+            key = K{};
+            return true;
         }
     }
 
     // ========================= 辅助方法 =========================
 
+    /**
+     * @brief 新建一个值；std::pmr 类型从当前线程的反序列化内存资源分配
+     */
+    template<typename T>
+    static T make_json_value() {
+        if constexpr (is_pmr_allocated<T>::value) {
+            return T(typename T::allocator_type(JsonCurrentMemoryResource()));
+        } else {
+            return T{};
+        }
+    }
+
+    /**
+     * @brief 在 optional 内原地新建字段值（分配规则同 make_json_value）
+     */
+    template<typename T>
+    static T& emplace_json_value(std::optional<T>& field) {
+        if constexpr (is_pmr_allocated<T>::value) {
+            return field.emplace(typename T::allocator_type(JsonCurrentMemoryResource()));
+        } else {
+            return field.emplace();
+        }
+    }
+
+    /**
+     * @brief 在序列容器末尾新建元素
+     * @details std::pmr 容器按 uses-allocator 规则用容器自己的资源构造元素；
+     * 普通容器中的 std::pmr 元素使用当前线程的资源
+     */
+    template<typename C>
+    static void emplace_json_back(C& out) {
+        using E = typename C::value_type;
+        if constexpr (is_pmr_allocated<E>::value && !is_pmr_allocated<C>::value) {
+            out.emplace_back(make_json_value<E>());
+        } else {
+            out.emplace_back();
+        }
+    }
+
+    /**
+     * @brief 取键 k 对应的值，不存在时新建（分配规则同 emplace_json_back）
+     */
+    template<typename M, typename K>
+    static typename M::mapped_type& emplace_json_mapped(M& out, K&& k) {
+        using V = typename M::mapped_type;
+        if constexpr (is_pmr_allocated<V>::value && !is_pmr_allocated<M>::value) {
+            return out.try_emplace(std::forward<K>(k), make_json_value<V>()).first->second;
+        } else {
+            return out.try_emplace(std::forward<K>(k)).first->second;
+        }
+    }
+
     /**
      * @brief 从字符串转换键类型
      * @tparam K 键类型
      * @param str 字符串表示的键
-     * @return 转换后的键值
+     * @return 转换后的键值，无法转换时为 K{}
      */
     template<typename K>
     K from_string(const std::string& str) const {
-        if constexpr (std::is_same_v<K, std::string>) {
-            return str;
-        } else if constexpr (std::is_same_v<K, int>) {
-            return std::stoi(str);
-        } else if constexpr (std::is_same_v<K, long>) {
-            return std::stol(str);
-        } else if constexpr (std::is_same_v<K, long long>) {
-            return std::stoll(str);
-        } else if constexpr (std::is_same_v<K, unsigned int>) {
-            return std::stoul(str);
-        } else if constexpr (std::is_same_v<K, unsigned long>) {
-            return std::stoul(str);
-        } else if constexpr (std::is_same_v<K, unsigned long long>) {
-            return std::stoull(str);
-        } else if constexpr (std::is_same_v<K, float>) {
-            return std::stof(str);
-        } else if constexpr (std::is_same_v<K, double>) {
-            return std::stod(str);
-        } else {
-            return K{};
-        }
+        K key{};
+        key_from_string(str, key);
+        return key;
     }
 };
 
 // ========================= 宏定义 =========================
 
+/**
+ * @brief 生成流式反序列化所需的重载（供 JSON_DESERIALIZE* 宏内部使用）
+ * @param READ_FIELD 查找并读取字段的表达式，其中读取器为 r、键为 key、本类字段表为 JSON_FIELD_LIST_、名字查找表为 table
+ * @details 派生类声明 from_json(const Json::Value&) 会隐藏基类的 from_json(JsonReader&)，因此在派生类中重新声明。
+ * 同时提供 from_json(const Json::Value&, std::pmr::memory_resource*)：新建的 std::pmr 字段从 resource 分配
+ */
+#ifndef JSON_READER_METHODS_
+#define JSON_READER_METHODS_(READ_FIELD) \
+    virtual bool from_json(JsonReader& r) override { \
+        return read_json_object(r); \
+    } \
+    void from_json(const Json::Value& j, std::pmr::memory_resource* resource) { \
+        JsonMemoryResourceScope scope(resource); \
+        from_json(j); \
+    } \
+    virtual bool from_json_field(JsonReader& r, std::string_view key) override { \
+        static constexpr auto table = MakeJsonFieldTable(JSON_FIELD_LIST_); \
+        return READ_FIELD; \
+    }
+#endif
+
+/**
+ * @brief 生成二进制反序列化重载（供 JSON_DESERIALIZE* 宏内部使用）
+ * @param READ_FIELDS 读取字段块的表达式（bool），其中读取器名为 r、本类字段表为 JSON_FIELD_LIST_
+ */
+#ifndef JSON_BINARY_READER_METHODS_
+#define JSON_BINARY_READER_METHODS_(READ_FIELDS) \
+    virtual bool from_binary(JsonBinaryReader& r) override { \
+        return READ_FIELDS; \
+    }
+#endif
+
+/**
+ * @brief 从 JSON 文本创建对象的静态方法（流式，供 CREATE_FROM_JSON / JSON_SERIALIZE_COMPLETE 使用）
+ * @param CLASS_NAME 类名
+ * @details 提供：
+ *  - from_json_string(std::string_view) 返回 std::optional<CLASS_NAME>
+ *  - from_json_array_string(std::string_view) 返回 std::vector<CLASS_NAME>，元素逐个在 vector 内构造（出错时为空）
+ *  - 并行版本 from_json_array_string(json, executor, chunkSize)：先单线程切出各元素的原始文本，
+ *    再按块并行解析到预先分配的槽位，结果顺序与输入一致（出错时为空）
+ *  - 并行版本 from_json_array(const Json::Value&, executor, chunkSize)：按块并行填充预先分配的槽位
+ *  - 内存资源版本 from_json_string(json, resource) / from_json_array_string(json, resource) /
+ *    from_json_array(const Json::Value&, resource)：新建的 std::pmr 字段（含嵌套对象）与返回的
+ *    std::pmr::vector 本身都从 resource 分配，整批可随 resource 一次释放
+ */
+#ifndef JSON_PARSE_METHODS_
+#define JSON_PARSE_METHODS_(CLASS_NAME) \
+    static std::optional<CLASS_NAME> from_json_string(std::string_view json) { \
+        CLASS_NAME obj; \
+        if (!obj.read_json(json)) return std::nullopt; \
+        return obj; \
+    } \
+    static std::vector<CLASS_NAME> from_json_array_string(std::string_view json) { \
+        std::vector<CLASS_NAME> objects; \
+        JsonReader r(json); \
+        if (!r.BeginArray()) return objects; \
+        while (r.NextElement()) { \
+            objects.emplace_back(); \
+            if (!static_cast<JsonDeserializer&>(objects.back()).from_json(r)) break; \
+        } \
+        if (!r.AtEnd()) objects.clear(); \
+        return objects; \
+    } \
+    static std::optional<CLASS_NAME> from_json_string(std::string_view json, std::pmr::memory_resource* resource) { \
+        JsonMemoryResourceScope scope(resource); \
+        return from_json_string(json); \
+    } \
+    static std::pmr::vector<CLASS_NAME> from_json_array_string(std::string_view json, \
+                                                               std::pmr::memory_resource* resource) { \
+        JsonMemoryResourceScope scope(resource); \
+        std::pmr::vector<CLASS_NAME> objects(resource); \
+        JsonReader r(json); \
+        if (!r.BeginArray()) return objects; \
+        while (r.NextElement()) { \
+            objects.emplace_back(); \
+            if (!static_cast<JsonDeserializer&>(objects.back()).from_json(r)) break; \
+        } \
+        if (!r.AtEnd()) objects.clear(); \
+        return objects; \
+    } \
+    static std::pmr::vector<CLASS_NAME> from_json_array(const Json::Value& j, std::pmr::memory_resource* resource) { \
+        JsonMemoryResourceScope scope(resource); \
+        std::pmr::vector<CLASS_NAME> objects(resource); \
+        if (!j.isArray()) return objects; \
+        objects.reserve(j.size()); \
+        for (const auto& item : j) { \
+            objects.emplace_back(); \
+            static_cast<JsonDeserializer&>(objects.back()).from_json(item); \
+        } \
+        return objects; \
+    } \
+    template<typename Executor, typename = typename JsonExecutorTask<Executor>::type> \
+    static std::vector<CLASS_NAME> from_json_array_string(std::string_view json, Executor& executor, \
+                                                          size_t chunkSize = 1024) { \
+        std::vector<std::string_view> elements; \
+        JsonReader r(json); \
+        if (!r.BeginArray()) return {}; \
+        while (r.NextElement()) { \
+            if (!r.Capture(elements.emplace_back())) return {}; \
+        } \
+        if (!r.AtEnd()) return {}; \
+        std::vector<CLASS_NAME> objects(elements.size()); \
+        std::atomic<bool> failed{false}; \
+        JsonParallelFor(executor, elements.size(), chunkSize, [&](size_t, size_t begin, size_t end) { \
+            for (size_t i = begin; i < end && !failed.load(std::memory_order_relaxed); ++i) { \
+                JsonReader element(elements[i]); \
+                if (!static_cast<JsonDeserializer&>(objects[i]).from_json(element) || !element.AtEnd()) { \
+                    failed.store(true, std::memory_order_relaxed); \
+                } \
+            } \
+        }); \
+        if (failed.load(std::memory_order_relaxed)) objects.clear(); \
+        return objects; \
+    } \
+    template<typename Executor, typename = typename JsonExecutorTask<Executor>::type> \
+    static std::vector<CLASS_NAME> from_json_array(const Json::Value& j, Executor& executor, \
+                                                   size_t chunkSize = 1024) { \
+        if (!j.isArray()) return {}; \
+        std::vector<CLASS_NAME> objects(j.size()); \
+        JsonParallelFor(executor, objects.size(), chunkSize, [&](size_t, size_t begin, size_t end) { \
+            for (size_t i = begin; i < end; ++i) { \
+                static_cast<JsonDeserializer&>(objects[i]).from_json(j[static_cast<Json::ArrayIndex>(i)]); \
+            } \
+        }); \
+        return objects; \
+    }
+#endif
+
 /**
  * @brief 自动生成 JSON 反序列化函数宏
  * @param BASE 父类名
@@ -151,9 +615,12 @@ public:
 #ifndef JSON_DESERIALIZE
 #define JSON_DESERIALIZE(BASE, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual void from_json(const Json::Value& j) override { \
-        BASE::from_json(j, __VA_ARGS__); \
-    }
+        BASE::from_json(j, *this, JSON_FIELD_LIST_); \
+    } \
+    JSON_READER_METHODS_(BASE::from_json_field(r, key, *this, JSON_FIELD_LIST_, table)) \
+    JSON_BINARY_READER_METHODS_(BASE::from_binary_fields(r, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
@@ -164,9 +631,12 @@ public: \
 #ifndef JSON_DESERIALIZE_WITH_PARENT
 #define JSON_DESERIALIZE_WITH_PARENT(BASE, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual void from_json(const Json::Value& j) override { \
-        BASE::from_json(j, __VA_ARGS__); \
-    }
+        BASE::from_json(j, *this, JSON_FIELD_LIST_); \
+    } \
+    JSON_READER_METHODS_(BASE::from_json_field(r, key, *this, JSON_FIELD_LIST_, table)) \
+    JSON_BINARY_READER_METHODS_(BASE::from_binary_fields(r, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
@@ -177,38 +647,45 @@ public: \
 #ifndef JSON_DESERIALIZE_INHERIT
 #define JSON_DESERIALIZE_INHERIT(PARENT_CLASS, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual void from_json(const Json::Value& j) override { \
         /* 先调用父类的 from_json 处理父类字段 */ \
         PARENT_CLASS::from_json(j); \
         /* 再处理子类字段 */ \
-        JsonDeserializer::from_json(j, __VA_ARGS__); \
-    }
+        JsonDeserializer::from_json(j, *this, JSON_FIELD_LIST_); \
+    } \
+    JSON_READER_METHODS_(JsonDeserializer::from_json_field(r, key, *this, JSON_FIELD_LIST_, table) || \
+                         PARENT_CLASS::from_json_field(r, key)) \
+    JSON_BINARY_READER_METHODS_(PARENT_CLASS::from_binary(r) && \
+                                JsonDeserializer::from_binary_fields(r, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
  * @brief 为类提供便捷的静态反序列化方法宏
  * @param CLASS_NAME 类名
  * @details 提供：
- *  - 静态方法 from_json() 返回 std::optional<CLASS_NAME>
+ *  - 静态方法 create_from_json() 返回 std::optional<CLASS_NAME>
+ *    （不命名为 from_json：同签名的静态函数不能与虚函数 from_json(const Json::Value&) 共存）
  *  - 静态方法 from_json_array() 返回 std::vector<CLASS_NAME>
  */
 #ifndef CREATE_FROM_JSON
 #define CREATE_FROM_JSON(CLASS_NAME) \
 public: \
-    static std::optional<CLASS_NAME> from_json(const Json::Value& j) { \
+    static std::optional<CLASS_NAME> create_from_json(const Json::Value& j) { \
         if (j.isNull()) return std::nullopt; \
-        CLASS_NAME obj; \
-        obj.from_json(j); \
+        std::optional<CLASS_NAME> obj(std::in_place); \
+        static_cast<JsonDeserializer&>(*obj).from_json(j); \
         return obj; \
     } \
     static std::vector<CLASS_NAME> from_json_array(const Json::Value& j) { \
         std::vector<CLASS_NAME> objects; \
         if (!j.isArray()) return objects; \
+        objects.reserve(j.size()); \
         for (const auto& item : j) { \
-            CLASS_NAME obj; \
-            obj.from_json(item); \
-            objects.push_back(std::move(obj)); \
+            objects.emplace_back(); \
+            static_cast<JsonDeserializer&>(objects.back()).from_json(item); \
         } \
         return objects; \
-    }
+    } \
+    JSON_PARSE_METHODS_(CLASS_NAME)
 #endif
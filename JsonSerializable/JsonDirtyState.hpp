@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief 字段修改记录（供 JSON_DIRTY_TRACKING 使用）
+ * @details 按字段在 FIELD_PAIR 列表中的下标记录两组位：
+ * - 修改位：自上次 to_json_delta() 以来被修改过的字段，to_json_delta() 写出后清空
+ * - 缓存位：该字段上次写出的 JSON 文本仍然有效，to_json_cached() 直接拼接缓存文本
+ *
+ * 位图按需增长，未修改过字段的对象不分配内存。
+ */
+class JsonDirtyState {
+public:
+    /**
+     * @brief 记录字段被修改：置修改位并使缓存失效
+     */
+    void Mark(size_t index) {
+        Set(_dirty, index);
+        Reset(_cached, index);
+    }
+
+    bool Dirty(size_t index) const { return Test(_dirty, index); }
+
+    /**
+     * @brief 是否有任何字段被修改
+     */
+    bool Any() const {
+        for (uint64_t word : _dirty) {
+            if (word != 0) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief 清空修改位（缓存不受影响）
+     */
+    void ClearDirty() {
+        for (uint64_t& word : _dirty) word = 0;
+    }
+
+    bool Cached(size_t index) const { return Test(_cached, index); }
+
+    /**
+     * @brief 字段的缓存文本（字段值的紧凑 JSON，不含键）
+     */
+    std::string& Fragment(size_t index) {
+        if (index >= _fragments.size()) _fragments.resize(index + 1);
+        return _fragments[index];
+    }
+
+    /**
+     * @brief 标记 Fragment(index) 已更新
+     */
+    void SetCached(size_t index) {
+        Set(_cached, index);
+    }
+
+    /**
+     * @brief 丢弃全部缓存文本
+     */
+    void ClearCache() {
+        _cached.clear();
+        _fragments.clear();
+    }
+
+private:
+    static bool Test(const std::vector<uint64_t>& bits, size_t index) {
+        size_t word = index / 64;
+        return word < bits.size() && ((bits[word] >> (index % 64)) & 1) != 0;
+    }
+
+    static void Set(std::vector<uint64_t>& bits, size_t index) {
+        size_t word = index / 64;
+        if (word >= bits.size()) bits.resize(word + 1);
+        bits[word] |= uint64_t(1) << (index % 64);
+    }
+
+    static void Reset(std::vector<uint64_t>& bits, size_t index) {
+        size_t word = index / 64;
+        if (word < bits.size()) bits[word] &= ~(uint64_t(1) << (index % 64));
+    }
+
+    std::vector<uint64_t> _dirty;
+    std::vector<uint64_t> _cached;
+    std::vector<std::string> _fragments;
+};
+
+/**
+ * @brief 判断类本身（而非其父类）是否声明了 JSON_DIRTY_TRACKING
+ */
+template<typename T, typename = void>
+struct is_json_dirty_tracked : std::false_type {};
+
+template<typename T>
+struct is_json_dirty_tracked<T, std::void_t<typename T::json_dirty_class_>>
+    : std::is_same<typename T::json_dirty_class_, std::remove_cv_t<T>> {};
+
+/**
+ * @brief 记录 self 的字段 member 被修改（由 FIELD* 宏生成的 set_ / reset_ 及反序列化调用）
+ * @details 未声明 JSON_DIRTY_TRACKING 的类为空操作
+ */
+template<typename Self, typename Member>
+inline void JsonMarkDirty(Self& self, Member member) {
+    if constexpr (is_json_dirty_tracked<Self>::value) {
+        int index = self.Self::json_field_index_(member);
+        if (index >= 0) self.Self::json_dirty_state_().Mark(static_cast<size_t>(index));
+    }
+}
+
+/**
+ * @brief 为类开启字段修改跟踪
+ * @param CLASS 当前类名
+ * @details 在类内部与 JSON_SERIALIZE* / JSON_SERIALIZE_FULL* 宏一起使用：
+ *  - set_xxx() / reset_xxx() 以及各反序列化路径会记录被修改的字段
+ *  - to_json_delta() 只写出修改过的字段（已重置的字段写为 null）并清空修改记录，
+ *    apply_json_delta() 在另一端应用（null 重置字段）
+ *  - to_json_cached() 只重新生成修改过的字段，其余字段拼接上次写出的文本
+ *
+ * 继承结构中每一层分别声明，只跟踪本层 FIELD_PAIR 列表中的字段；未声明的层每次都完整写出。
+ * 跟踪状态随对象复制；同一对象的修改与 to_json_delta() / to_json_cached() 不能并发。
+ */
+#ifndef JSON_DIRTY_TRACKING
+#define JSON_DIRTY_TRACKING(CLASS) \
+private: \
+    JsonDirtyState _json_dirty; \
+public: \
+    using json_dirty_class_ = CLASS; \
+    JsonDirtyState& json_dirty_state_() { return _json_dirty; } \
+    const JsonDirtyState& json_dirty_state_() const { return _json_dirty; }
+#endif
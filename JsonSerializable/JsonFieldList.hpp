@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 编译期字段描述：字段名 + 成员指针
+ * @tparam Class 声明该字段的类
+ * @tparam T 字段值类型（成员类型为 std::optional<T>）
+ */
+template<typename Class, typename T>
+struct JsonField {
+    using class_type = Class;
+    using value_type = T;
+
+    std::string_view name;
+    std::optional<T> Class::* member;
+};
+
+/**
+ * @brief 编译期字段表
+ * @details 由 JSON_* 宏从 FIELD_PAIR 列表生成为每个类一份的 static constexpr 成员（JSON_FIELDS_）：
+ * 字段名是指向字面量的 std::string_view，字段以成员指针访问。
+ * 各后端（DOM、流式 JSON、二进制）通过 ForEach / All / Visit 以折叠表达式展开，
+ * 每次调用不递归、不复制参数包、不构造字段名字符串。
+ *
+ * @code
+ *   constexpr auto& fields = JSON_FIELD_LIST_;   // 在 JSON_* 宏所在类的成员函数内
+ *   fields.ForEach([&](const auto& field) {
+ *       const auto& value = self.*field.member;   // const std::optional<T>&
+ *       ...
+ *   });
+ * @endcode
+ */
+template<typename... Fields>
+struct JsonFieldList {
+    static constexpr size_t size = sizeof...(Fields);
+
+    std::tuple<Fields...> fields;
+
+    /**
+     * @brief 按声明顺序对每个字段调用 f(field)
+     */
+    template<typename F>
+    void ForEach(F&& f) const {
+        std::apply([&](const Fields&... field) { (f(field), ...); }, fields);
+    }
+
+    /**
+     * @brief 按声明顺序对每个字段调用 f(field)，遇到返回 false 时停止
+     * @return 是否全部返回 true
+     */
+    template<typename F>
+    bool All(F&& f) const {
+        return std::apply([&](const Fields&... field) { return (f(field) && ...); }, fields);
+    }
+
+    /**
+     * @brief 对下标为 index 的字段调用 f(field)
+     * @return index 是否有效
+     */
+    template<typename F>
+    bool Visit(size_t index, F&& f) const {
+        return VisitAt(index, f, std::index_sequence_for<Fields...>{});
+    }
+
+    /**
+     * @brief 查找成员指针对应的字段下标
+     * @return 字段在 FIELD_PAIR 列表中的下标，不在表中时为 -1
+     */
+    template<typename M>
+    constexpr int IndexOf(M member) const {
+        return IndexOfAt(member, std::index_sequence_for<Fields...>{});
+    }
+
+private:
+    template<typename F, size_t... I>
+    bool VisitAt(size_t index, F& f, std::index_sequence<I...>) const {
+        return ((index == I ? (f(std::get<I>(fields)), true) : false) || ...);
+    }
+
+    template<typename M, size_t... I>
+    constexpr int IndexOfAt(M member, std::index_sequence<I...>) const {
+        int index = -1;
+        ((Matches<I>(member) ? (index = static_cast<int>(I), true) : false) || ...);
+        return index;
+    }
+
+    template<size_t I, typename M>
+    constexpr bool Matches(M member) const {
+        if constexpr (std::is_same_v<std::decay_t<decltype(std::get<I>(fields).member)>, M>) {
+            return std::get<I>(fields).member == member;
+        } else {
+            return false;
+        }
+    }
+};
+
+template<typename Class, typename T>
+constexpr JsonField<Class, T> MakeJsonField(std::string_view name, std::optional<T> Class::* member) {
+    return JsonField<Class, T>{name, member};
+}
+
+template<typename Tuple, size_t... I>
+constexpr auto MakeJsonFieldListFrom(const Tuple& pairs, std::index_sequence<I...>) {
+    return JsonFieldList<decltype(MakeJsonField(std::get<2 * I>(pairs), std::get<2 * I + 1>(pairs)))...>{
+        {MakeJsonField(std::get<2 * I>(pairs), std::get<2 * I + 1>(pairs))...}};
+}
+
+/**
+ * @brief 由 FIELD_PAIR 列表（名字, 成员指针, 名字, 成员指针, ...）构造字段表（编译期求值）
+ */
+template<typename... Args>
+constexpr auto MakeJsonFieldList(Args... args) {
+    static_assert(sizeof...(Args) % 2 == 0, "MakeJsonFieldList: expects FIELD_PAIR(name) arguments");
+    return MakeJsonFieldListFrom(std::make_tuple(args...), std::make_index_sequence<sizeof...(Args) / 2>{});
+}
+
+/**
+ * @brief 在类内定义本类的编译期字段表 json_fields_（每个类一次，由 JSON_* 宏展开）
+ * @param ... FIELD_PAIR 列表
+ * @details
+ * 宏只拿得到字段名、拿不到类名，因此字段表是以本类为模板参数 JsonSelf_ 的 static constexpr 变量模板，
+ * FIELD_PAIR 展开为 &JsonSelf_::_name；成员函数内以 JSON_FIELD_LIST_ 取用，实例化只发生一次。
+ * 字段表定义在类内，同一个类只能使用一个带字段列表的 JSON_* 宏（双向时用 JSON_SERIALIZE_FULL*）
+ */
+#ifndef JSON_FIELDS_
+#define JSON_FIELDS_(...) \
+    template<typename JsonSelf_> \
+    static constexpr auto json_fields_ = MakeJsonFieldList(__VA_ARGS__);
+#endif
+
+/**
+ * @brief 在 JSON_* 宏所在类的成员函数内取得本类的字段表（常量表达式）
+ */
+#ifndef JSON_FIELD_LIST_
+#define JSON_FIELD_LIST_ json_fields_<std::remove_cv_t<std::remove_pointer_t<decltype(this)>>>
+#endif
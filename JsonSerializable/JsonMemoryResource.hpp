@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory_resource>
+
+/**
+ * @brief 反序列化使用的内存资源
+ * @details 反序列化过程中新建的 std::pmr 字段（FIELD(std::pmr::string, ...)、
+ * FIELD_PMR_MAP 等）从当前线程的内存资源分配；嵌套对象的字段同样如此，
+ * 因此不需要给每一层 from_json 传递参数。
+ *
+ * 未设置时使用 std::pmr::get_default_resource()。
+ * 资源只对设置它的线程生效：并行批量反序列化（executor 重载）的工作线程不会使用它，
+ * 且 std::pmr::monotonic_buffer_resource 本身也不是线程安全的。
+ *
+ * 使用方法：
+ * @code
+ *   std::pmr::monotonic_buffer_resource arena(64 * 1024);
+ *   auto orders = Order::from_json_array_string(text, &arena);
+ *   ...                 // orders 内的 std::pmr 字段与数组本身都位于 arena
+ *   orders = {};        // 先销毁对象（monotonic 资源的 deallocate 为空操作）
+ *   arena.release();    // 一次释放整批
+ * @endcode
+ */
+
+/**
+ * @brief 当前线程用于反序列化的内存资源
+ */
+inline std::pmr::memory_resource*& JsonMemoryResourceSlot() {
+    thread_local std::pmr::memory_resource* resource = nullptr;
+    return resource;
+}
+
+inline std::pmr::memory_resource* JsonCurrentMemoryResource() {
+    std::pmr::memory_resource* resource = JsonMemoryResourceSlot();
+    return resource ? resource : std::pmr::get_default_resource();
+}
+
+/**
+ * @brief 在作用域内设置当前线程的反序列化内存资源，析构时恢复之前的值（可嵌套）
+ */
+class JsonMemoryResourceScope {
+public:
+    explicit JsonMemoryResourceScope(std::pmr::memory_resource* resource)
+        : _previous(JsonMemoryResourceSlot()) {
+        JsonMemoryResourceSlot() = resource;
+    }
+
+    ~JsonMemoryResourceScope() {
+        JsonMemoryResourceSlot() = _previous;
+    }
+
+    JsonMemoryResourceScope(const JsonMemoryResourceScope&) = delete;
+    JsonMemoryResourceScope& operator=(const JsonMemoryResourceScope&) = delete;
+
+private:
+    std::pmr::memory_resource* _previous;
+};
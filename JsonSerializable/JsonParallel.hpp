@@ -0,0 +1,238 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <type_traits>
+#include <Executor/EventCount.h>
+#include <Executor/LockFreeExecutor.h>
+#include <Executor/ThreadExecutor.h>
+
+/**
+ * @brief 批量序列化 / 反序列化的并行分块工具
+ * @details 供 JSON_SERIALIZE_COMPLETE / CREATE_FROM_JSON / TO_JSON_METHODS 生成的
+ * executor 重载使用：把 [0, count) 切成 chunkSize 大小的块，每块作为一个任务提交，
+ * 调用线程执行第 0 块并等待全部完成。每块写入自己的输出槽位（按块下标），
+ * 因此结果顺序与输入一致，与执行顺序无关。
+ *
+ * 支持的 executor：
+ * - ThreadExecutor<Task>：任务由其工作线程执行；调用者执行完自己的块后在闩上停车。
+ *   ThreadExecutor 必须已 Start() 且在调用期间保持运行
+ * - LockFreeExecutor<Task, P, Consumers::Multi>：只存储任务，调用者边等边从中取任务执行，
+ *   因此没有其它消费线程时也能完成
+ *
+ * Task 需要能由 void() 可调用对象构造（如 std::function<void()>）。
+ * 提交失败（队列已满）的块由调用线程直接执行。
+ *
+ * 生命周期与异常：
+ * - 完成闩由所有块任务共同持有（shared_ptr），最后一块 CountDown 后唤醒等待者时闩仍然存活
+ * - 每块的异常在块内捕获，调用者等全部块结束后重新抛出第一个异常，
+ *   与串行路径一样由调用者处理；body 在所有块结束前始终有效
+ * - 在 ThreadExecutor 自己的工作线程内调用时所有块直接在当前线程执行：
+ *   否则工作线程停车等待的块可能排在自己身后，全部工作线程都这样做时会死锁
+ */
+
+/**
+ * @brief 分块任务的完成闩
+ */
+class JsonChunkLatch {
+public:
+    explicit JsonChunkLatch(size_t count) : _remaining(count) {}
+
+    void CountDown() {
+        if (_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            _done.NotifyAll();
+        }
+    }
+
+    bool Done() const {
+        return _remaining.load(std::memory_order_acquire) == 0;
+    }
+
+    /**
+     * @brief 自旋后停车，直到计数归零
+     */
+    void Wait() {
+        for (size_t spin = 0; spin < kSpinCount; ++spin) {
+            if (Done()) return;
+            CpuRelax();
+        }
+        while (!Done()) {
+            auto key = _done.PrepareWait();
+            if (Done()) {
+                _done.CancelWait();
+                return;
+            }
+            _done.Wait(key);
+        }
+    }
+
+private:
+    static constexpr size_t kSpinCount = 64;
+
+    std::atomic<size_t> _remaining;
+    EventCount _done;
+};
+
+/**
+ * @brief 一次 JsonParallelFor 的共享状态：完成闩 + 第一个异常
+ */
+struct JsonChunkState {
+    explicit JsonChunkState(size_t count) : latch(count) {}
+
+    /// 执行一块，捕获其异常，最后计数
+    template<typename Body>
+    void Run(Body& body, size_t chunk, size_t begin, size_t end) {
+        try {
+            body(chunk, begin, end);
+        } catch (...) {
+            if (!failed.exchange(true, std::memory_order_acq_rel)) {
+                error = std::current_exception();
+            }
+        }
+        latch.CountDown();
+    }
+
+    JsonChunkLatch latch;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error; ///< 只由第一个失败的块写入，闩完成后读取
+};
+
+/**
+ * @brief executor 的任务类型
+ */
+template<typename Executor>
+struct JsonExecutorTask;
+
+template<typename Task>
+struct JsonExecutorTask<ThreadExecutor<Task>> {
+    using type = Task;
+};
+
+template<typename Task, Producers P, Consumers C>
+struct JsonExecutorTask<LockFreeExecutor<Task, P, C>> {
+    using type = Task;
+};
+
+/**
+ * @brief 提交一个分块任务
+ * @return false 表示未能入队，调用者应自行执行
+ */
+template<typename Task>
+bool JsonSubmitChunk(ThreadExecutor<Task>& executor, Task&& task) {
+    return executor.TrySubmit(std::move(task));
+}
+
+template<typename Task, Producers P>
+bool JsonSubmitChunk(LockFreeExecutor<Task, P, Consumers::Multi>& executor, Task&& task) {
+    return executor.Add(std::move(task));
+}
+
+/**
+ * @brief 是否必须在当前线程执行全部块（见文件头「生命周期与异常」）
+ */
+template<typename Task>
+bool JsonRunsInline(const ThreadExecutor<Task>& executor) {
+    return executor.InWorkerThread();
+}
+
+template<typename Task, Producers P>
+bool JsonRunsInline(const LockFreeExecutor<Task, P, Consumers::Multi>&) {
+    return false;
+}
+
+/**
+ * @brief 等待分块完成
+ * @details ThreadExecutor 由工作线程执行，调用者停车；
+ * LockFreeExecutor 没有自己的线程，调用者不断取任务执行（可能执行到其它提交者的任务），
+ * 取不到时让出时间片而不停车，避免任务滞留在队列中无人执行
+ */
+template<typename Task>
+void JsonWaitChunks(ThreadExecutor<Task>&, JsonChunkLatch& latch) {
+    latch.Wait();
+}
+
+template<typename Task, Producers P>
+void JsonWaitChunks(LockFreeExecutor<Task, P, Consumers::Multi>& executor, JsonChunkLatch& latch) {
+    std::optional<Task> task;
+    while (!latch.Done()) {
+        if (executor.TryPop(task)) {
+            (*task)();
+            task.reset();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief 块数
+ */
+inline size_t JsonChunkCount(size_t count, size_t chunkSize) {
+    if (chunkSize == 0) chunkSize = 1;
+    return (count + chunkSize - 1) / chunkSize;
+}
+
+/**
+ * @brief 并行处理 [0, count)
+ * @tparam Executor ThreadExecutor 或 LockFreeExecutor
+ * @tparam Body void(size_t chunk, size_t begin, size_t end)
+ * @param executor 执行块任务的 executor
+ * @param count 元素数
+ * @param chunkSize 每块元素数（0 视为 1）
+ * @param body 处理一块；不同块可能并发执行
+ * @details 返回（或抛出 body 的异常）时所有块都已执行完毕
+ */
+template<typename Executor, typename Body>
+void JsonParallelFor(Executor& executor, size_t count, size_t chunkSize, Body&& body) {
+    if (chunkSize == 0) chunkSize = 1;
+    size_t chunks = JsonChunkCount(count, chunkSize);
+    if (chunks == 0) return;
+    if (chunks == 1 || JsonRunsInline(executor)) {
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            size_t begin = chunk * chunkSize;
+            body(chunk, begin, begin + chunkSize < count ? begin + chunkSize : count);
+        }
+        return;
+    }
+
+    auto state = std::make_shared<JsonChunkState>(chunks);
+    for (size_t chunk = 1; chunk < chunks; ++chunk) {
+        size_t begin = chunk * chunkSize;
+        size_t end = begin + chunkSize < count ? begin + chunkSize : count;
+        auto run = [&body, state, chunk, begin, end]() {
+            state->Run(body, chunk, begin, end);
+        };
+        if (!JsonSubmitChunk(executor, typename JsonExecutorTask<Executor>::type(run))) run();
+    }
+
+    state->Run(body, size_t{0}, size_t{0}, chunkSize);
+    JsonWaitChunks(executor, state->latch);
+    if (state->error) std::rethrow_exception(state->error);
+}
+
+/**
+ * @brief 以 '[' part0 ',' part1 ... ']' 拼接各块输出（空块跳过）
+ */
+inline std::string JsonJoinArray(const std::vector<std::string>& parts) {
+    size_t total = 2;
+    for (const auto& part : parts) total += part.size() + 1;
+
+    std::string out;
+    out.reserve(total);
+    out.push_back('[');
+    bool first = true;
+    for (const auto& part : parts) {
+        if (part.empty()) continue;
+        if (!first) out.push_back(',');
+        out.append(part);
+        first = false;
+    }
+    out.push_back(']');
+    return out;
+}
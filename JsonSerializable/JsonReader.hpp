@@ -0,0 +1,522 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cmath>
+#include <charconv>
+#include <type_traits>
+#include <jsoncpp/json/json.h>
+#include "JsonSerializable/TypeTraits.h"
+#include "JsonSerializable/JsonFieldList.hpp"
+
+/**
+ * @brief 拉取式（pull）JSON 读取器
+ * @details 在原始输入上顺序前进、一次遍历，不构建 Json::Value DOM。
+ * - 调用者按期望的结构拉取：BeginObject / NextKey、BeginArray / NextElement、Read、Skip
+ * - 不含转义的字符串与键直接返回指向输入的 std::string_view（零拷贝），
+ *   含转义时解码到内部缓冲区，视图在下一次读取字符串前有效
+ * - 任何语法或类型错误都会使读取器进入失败状态（Ok() 为 false），之后的操作全部返回 false
+ * - 输入在读取期间必须保持有效
+ *
+ * 使用方法：
+ * @code
+ *   JsonReader r(text);
+ *   std::string_view key;
+ *   if (r.BeginObject()) {
+ *       while (r.NextKey(key)) {
+ *           if (key == "id") r.Read(id);
+ *           else r.Skip();
+ *       }
+ *   }
+ *   bool ok = r.Ok() && r.AtEnd();
+ * @endcode
+ */
+class JsonReader {
+public:
+    /// 下一个值的类型
+    enum class Type { Null, Bool, Number, String, Array, Object, Invalid };
+
+    /// 嵌套深度上限（防止恶意输入耗尽栈）
+    static constexpr size_t kMaxDepth = 512;
+
+    explicit JsonReader(std::string_view input)
+        : _begin(input.data()), _p(input.data()), _end(input.data() + input.size())
+    {}
+
+    /**
+     * @brief 是否未发生错误
+     */
+    bool Ok() const { return !_failed; }
+
+    /**
+     * @brief 出错位置（相对输入起点的字节偏移）
+     */
+    size_t ErrorOffset() const { return _errorAt; }
+
+    /**
+     * @brief 除空白外输入是否已全部消耗
+     */
+    bool AtEnd() {
+        SkipSpace();
+        return !_failed && _p == _end;
+    }
+
+    /**
+     * @brief 设置字段值为 null 时是否重置字段（默认保持字段不变；apply_json_delta 使用重置语义）
+     */
+    void SetNullResetsFields(bool enable) { _nullResetsFields = enable; }
+
+    bool NullResetsFields() const { return _nullResetsFields; }
+
+    /**
+     * @brief 主动标记失败（例如值合法但不符合目标类型）
+     * @return 恒为 false
+     */
+    bool Fail() {
+        if (!_failed) {
+            _failed = true;
+            _errorAt = static_cast<size_t>(_p - _begin);
+        }
+        return false;
+    }
+
+    /**
+     * @brief 查看下一个值的类型（不消耗）
+     */
+    Type Peek() {
+        SkipSpace();
+        if (_failed || _p == _end) return Type::Invalid;
+        switch (*_p) {
+            case 'n': return Type::Null;
+            case 't': case 'f': return Type::Bool;
+            case '"': return Type::String;
+            case '[': return Type::Array;
+            case '{': return Type::Object;
+            default:
+                return (*_p == '-' || (*_p >= '0' && *_p <= '9')) ? Type::Number : Type::Invalid;
+        }
+    }
+
+    // ========================= 结构 =========================
+
+    bool BeginObject() {
+        return Open('{');
+    }
+
+    /**
+     * @brief 读取下一个键及其后的 ':'
+     * @param key 键名
+     * @return false 表示对象结束（已消耗 '}'）或出错，用 Ok() 区分
+     */
+    bool NextKey(std::string_view& key) {
+        if (!Advance('}')) return false;
+        return ReadString(key) && Consume(':');
+    }
+
+    bool BeginArray() {
+        return Open('[');
+    }
+
+    /**
+     * @brief 定位到下一个数组元素
+     * @return false 表示数组结束（已消耗 ']'）或出错，用 Ok() 区分
+     */
+    bool NextElement() {
+        return Advance(']');
+    }
+
+    // ========================= 值 =========================
+
+    /**
+     * @brief 下一个值为 null 时消耗它
+     * @return 是否为 null（不是 null 时不消耗、不算错误）
+     */
+    bool ReadNull() {
+        if (Peek() != Type::Null) return false;
+        return Literal("null");
+    }
+
+    /**
+     * @brief 读取标量
+     * @tparam T bool、整数、浮点或字符串（std::string / std::pmr::string）；null 读为 T{}
+     * @details 整数目标接受整数值的小数 / 指数形式（如 3.0、1e3）
+     */
+    template<typename T>
+    bool Read(T& out) {
+        if (ReadNull()) {
+            out = T{};
+            return true;
+        }
+        if constexpr (std::is_same_v<T, bool>) {
+            if (Peek() != Type::Bool) return Fail();
+            out = (*_p == 't');
+            return Literal(out ? "true" : "false");
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            std::string_view token = ScanNumber();
+            if (token.empty()) return Fail();
+            const char* first = token.data();
+            const char* last = first + token.size();
+            auto r = std::from_chars(first, last, out);
+            if (r.ec == std::errc() && r.ptr == last) return true;
+            if constexpr (std::is_integral_v<T>) {
+                double d = 0;
+                auto rd = std::from_chars(first, last, d);
+                // 上界取 2^digits（不含）：max() 转为 double 时可能向上舍入到 2^digits，越界转换是 UB
+                constexpr double upper = 2.0 * static_cast<double>(T(1) << (std::numeric_limits<T>::digits - 1));
+                if (rd.ec == std::errc() && rd.ptr == last && std::trunc(d) == d &&
+                    d >= static_cast<double>(std::numeric_limits<T>::lowest()) && d < upper) {
+                    out = static_cast<T>(d);
+                    return true;
+                }
+            }
+            return Fail();
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            if (!Consume('"')) return false;
+            out.clear();
+            return Unescape(out);
+        } else if constexpr (is_string<T>::value) {
+            std::string_view s;
+            if (!ReadString(s)) return false;
+            out.assign(s.data(), s.size());
+            return true;
+        } else {
+            static_assert(std::is_same_v<T, bool>, "JsonReader::Read: unsupported type");
+            return false;
+        }
+    }
+
+    /**
+     * @brief 读取剩余任意值为 Json::Value（兼容只实现了 DOM 反序列化的类型）
+     */
+    bool Read(Json::Value& out) {
+        switch (Peek()) {
+            case Type::Null:
+                out = Json::Value();
+                return Literal("null");
+            case Type::Bool: {
+                bool b = false;
+                if (!Read(b)) return false;
+                out = b;
+                return true;
+            }
+            case Type::Number: {
+                std::string_view token = ScanNumber();
+                const char* last = token.data() + token.size();
+                if (token.find_first_of(".eE") == std::string_view::npos) {
+                    Json::LargestInt i = 0;
+                    if (std::from_chars(token.data(), last, i).ptr == last) { out = i; return true; }
+                    Json::LargestUInt u = 0;
+                    if (std::from_chars(token.data(), last, u).ptr == last) { out = u; return true; }
+                }
+                double d = 0;
+                auto r = std::from_chars(token.data(), last, d);
+                if (token.empty() || r.ec != std::errc() || r.ptr != last) return Fail();
+                out = d;
+                return true;
+            }
+            case Type::String: {
+                std::string_view s;
+                if (!ReadString(s)) return false;
+                out = Json::Value(s.data(), s.data() + s.size());
+                return true;
+            }
+            case Type::Array: {
+                out = Json::Value(Json::arrayValue);
+                if (!BeginArray()) return false;
+                while (NextElement()) {
+                    if (!Read(out.append(Json::Value()))) return false;
+                }
+                return Ok();
+            }
+            case Type::Object: {
+                out = Json::Value(Json::objectValue);
+                if (!BeginObject()) return false;
+                std::string_view key;
+                while (NextKey(key)) {
+                    if (!Read(out[std::string(key)])) return false;
+                }
+                return Ok();
+            }
+            default:
+                return Fail();
+        }
+    }
+
+    /**
+     * @brief 读取字符串
+     * @param out 无转义时指向输入，否则指向内部缓冲区（下一次读取字符串前有效）
+     */
+    bool ReadString(std::string_view& out) {
+        if (!Consume('"')) return false;
+        const char* start = _p;
+        while (_p < _end && *_p != '"' && *_p != '\\') {
+            if (static_cast<unsigned char>(*_p) < 0x20) return Fail();
+            ++_p;
+        }
+        if (_p == _end) return Fail();
+        if (*_p == '"') {
+            out = std::string_view(start, static_cast<size_t>(_p - start));
+            ++_p;
+            return true;
+        }
+        _scratch.assign(start, static_cast<size_t>(_p - start));
+        if (!Unescape(_scratch)) return false;
+        out = _scratch;
+        return true;
+    }
+
+    /**
+     * @brief 跳过下一个值（含嵌套结构）
+     */
+    bool Skip() {
+        switch (Peek()) {
+            case Type::Null:   return Literal("null");
+            case Type::Bool:   return Literal(*_p == 't' ? "true" : "false");
+            case Type::Number: return !ScanNumber().empty() || Fail();
+            case Type::String: {
+                std::string_view s;
+                return ReadString(s);
+            }
+            case Type::Array:
+                if (!BeginArray()) return false;
+                while (NextElement()) {
+                    if (!Skip()) return false;
+                }
+                return Ok();
+            case Type::Object: {
+                if (!BeginObject()) return false;
+                std::string_view key;
+                while (NextKey(key)) {
+                    if (!Skip()) return false;
+                }
+                return Ok();
+            }
+            default:
+                return Fail();
+        }
+    }
+
+    /**
+     * @brief 跳过下一个值，并给出它在输入中的原始文本
+     * @param raw 指向输入缓冲区的切片（不含前导空白），可交给另一个 JsonReader 单独解析
+     */
+    bool Capture(std::string_view& raw) {
+        if (_failed) return false;
+        SkipSpace();
+        const char* start = _p;
+        if (!Skip()) return false;
+        raw = std::string_view(start, static_cast<size_t>(_p - start));
+        return true;
+    }
+
+private:
+    void SkipSpace() {
+        while (_p < _end && (*_p == ' ' || *_p == '\n' || *_p == '\r' || *_p == '\t')) ++_p;
+    }
+
+    bool Consume(char c) {
+        if (_failed) return false;
+        SkipSpace();
+        if (_p == _end || *_p != c) return Fail();
+        ++_p;
+        return true;
+    }
+
+    bool Literal(std::string_view word) {
+        if (_failed) return false;
+        if (static_cast<size_t>(_end - _p) < word.size() || std::string_view(_p, word.size()) != word) return Fail();
+        _p += word.size();
+        return true;
+    }
+
+    bool Open(char c) {
+        if (!Consume(c)) return false;
+        if (_first.size() >= kMaxDepth) return Fail();
+        _first.push_back(1);
+        return true;
+    }
+
+    /**
+     * @brief 对象 / 数组内前进到下一项：遇到 close 则出栈并返回 false，非首项要求 ','
+     */
+    bool Advance(char close) {
+        if (_failed || _first.empty()) return Fail();
+        SkipSpace();
+        if (_p < _end && *_p == close) {
+            ++_p;
+            _first.pop_back();
+            return false;
+        }
+        if (_first.back()) {
+            _first.back() = 0;
+            return true;
+        }
+        return Consume(',');
+    }
+
+    /**
+     * @brief 取出数字记号（只做字符集扫描，由 from_chars 校验）
+     */
+    std::string_view ScanNumber() {
+        SkipSpace();
+        const char* start = _p;
+        while (_p < _end) {
+            char c = *_p;
+            if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') ++_p;
+            else break;
+        }
+        return std::string_view(start, static_cast<size_t>(_p - start));
+    }
+
+    static void AppendUtf8(std::string& out, uint32_t cp) {
+        if (cp < 0x80) {
+            out.push_back(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    bool ReadHex4(uint32_t& value) {
+        if (_end - _p < 4) return Fail();
+        value = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = *_p++;
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= static_cast<uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') value |= static_cast<uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') value |= static_cast<uint32_t>(c - 'A' + 10);
+            else return Fail();
+        }
+        return true;
+    }
+
+    /**
+     * @brief 从当前位置（开引号之后）解码到闭引号，追加到 out
+     */
+    bool Unescape(std::string& out) {
+        while (true) {
+            const char* run = _p;
+            while (_p < _end && *_p != '"' && *_p != '\\') {
+                if (static_cast<unsigned char>(*_p) < 0x20) return Fail();
+                ++_p;
+            }
+            out.append(run, static_cast<size_t>(_p - run));
+            if (_p == _end) return Fail();
+            if (*_p++ == '"') return true;
+
+            if (_p == _end) return Fail();
+            char c = *_p++;
+            switch (c) {
+                case '"':  out.push_back('"'); break;
+                case '\\': out.push_back('\\'); break;
+                case '/':  out.push_back('/'); break;
+                case 'b':  out.push_back('\b'); break;
+                case 'f':  out.push_back('\f'); break;
+                case 'n':  out.push_back('\n'); break;
+                case 'r':  out.push_back('\r'); break;
+                case 't':  out.push_back('\t'); break;
+                case 'u': {
+                    uint32_t cp = 0;
+                    if (!ReadHex4(cp)) return false;
+                    if (cp >= 0xD800 && cp <= 0xDBFF) {
+                        uint32_t low = 0;
+                        if (_end - _p < 2 || _p[0] != '\\' || _p[1] != 'u') return Fail();
+                        _p += 2;
+                        if (!ReadHex4(low) || low < 0xDC00 || low > 0xDFFF) return Fail();
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    AppendUtf8(out, cp);
+                    break;
+                }
+                default:
+                    return Fail();
+            }
+        }
+    }
+
+    const char* _begin;
+    const char* _p;
+    const char* _end;
+    bool _failed = false;
+    bool _nullResetsFields = false;
+    size_t _errorAt = 0;
+    std::vector<char> _first;   ///< 每层对象 / 数组是否尚未读过元素
+    std::string _scratch;       ///< 含转义字符串的解码缓冲区
+};
+
+/**
+ * @brief 字段名查找表：把字段表中的字段名按字典序排好，二分查找得到字段下标
+ * @tparam N 字段数
+ * @details 由 JSON_DESERIALIZE* 宏在每个类的 from_json_field 中以函数静态 constexpr 变量构造，
+ * 排序在编译期完成；只保存字段名（指向字面量的 std::string_view）与下标。
+ */
+template<size_t N>
+class JsonFieldTable {
+public:
+    template<typename... Fields>
+    constexpr explicit JsonFieldTable(const JsonFieldList<Fields...>& fields)
+        : JsonFieldTable(fields, std::index_sequence_for<Fields...>{})
+    {}
+
+    /**
+     * @brief 查找字段
+     * @return 字段在 FIELD_PAIR 列表中的下标，不存在时为 -1
+     */
+    constexpr int Find(std::string_view key) const {
+        const Entry* first = _entries;
+        const Entry* last = _entries + N;
+        while (first < last) {
+            const Entry* mid = first + (last - first) / 2;
+            int cmp = mid->name.compare(key);
+            if (cmp == 0) return mid->index;
+            if (cmp < 0) first = mid + 1;
+            else last = mid;
+        }
+        return -1;
+    }
+
+private:
+    struct Entry {
+        std::string_view name;
+        int index;
+    };
+
+    template<typename List, size_t... I>
+    constexpr JsonFieldTable(const List& fields, std::index_sequence<I...>)
+        : _entries{Entry{std::get<I>(fields.fields).name, static_cast<int>(I)}...}
+    {
+        // 插入排序（编译期执行）
+        for (size_t i = 1; i < N; ++i) {
+            Entry entry = _entries[i];
+            size_t j = i;
+            while (j > 0 && entry.name < _entries[j - 1].name) {
+                _entries[j] = _entries[j - 1];
+                --j;
+            }
+            _entries[j] = entry;
+        }
+    }
+
+    Entry _entries[N > 0 ? N : 1];
+};
+
+/**
+ * @brief 由字段表构造字段名查找表
+ */
+template<typename... Fields>
+constexpr JsonFieldTable<sizeof...(Fields)> MakeJsonFieldTable(const JsonFieldList<Fields...>& fields) {
+    return JsonFieldTable<sizeof...(Fields)>(fields);
+}
@@ -14,7 +14,9 @@ public:
 
     // 显式继承两个基类的接口
     using JsonDeserializer::from_json;
+    using JsonDeserializer::from_json_field;
     using JsonSerializer::to_json;
+    using JsonSerializer::to_json_fields;
 };
 
 // ========================= 宏定义 =========================
@@ -28,12 +30,19 @@ public:
 #ifndef JSON_SERIALIZE_FULL
 #define JSON_SERIALIZE_FULL(BASE, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual Json::Value to_json() const override { \
-        Json::Value j; BASE::to_json(j, __VA_ARGS__); return j; \
+        Json::Value j; BASE::to_json(j, *this, JSON_FIELD_LIST_); return j; \
     } \
+    JSON_WRITER_METHODS_(BASE::to_json_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_BINARY_WRITER_METHODS_(BASE::to_binary_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_DELTA_WRITER_METHODS_(BASE::to_json_delta_fields(w, *this, JSON_FIELD_LIST_), \
+                               BASE::to_json_cached_fields(w, *this, JSON_FIELD_LIST_)) \
     virtual void from_json(const Json::Value& j) override { \
-        BASE::from_json(j, __VA_ARGS__); \
-    }
+        BASE::from_json(j, *this, JSON_FIELD_LIST_); \
+    } \
+    JSON_READER_METHODS_(BASE::from_json_field(r, key, *this, JSON_FIELD_LIST_, table)) \
+    JSON_BINARY_READER_METHODS_(BASE::from_binary_fields(r, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
@@ -45,12 +54,19 @@ public: \
 #ifndef JSON_SERIALIZE_FULL_WITH_PARENT
 #define JSON_SERIALIZE_FULL_WITH_PARENT(BASE, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual Json::Value to_json() const override { \
-        Json::Value j; BASE::to_json(j, __VA_ARGS__); return j; \
+        Json::Value j; BASE::to_json(j, *this, JSON_FIELD_LIST_); return j; \
     } \
+    JSON_WRITER_METHODS_(BASE::to_json_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_BINARY_WRITER_METHODS_(BASE::to_binary_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_DELTA_WRITER_METHODS_(BASE::to_json_delta_fields(w, *this, JSON_FIELD_LIST_), \
+                               BASE::to_json_cached_fields(w, *this, JSON_FIELD_LIST_)) \
     virtual void from_json(const Json::Value& j) override { \
-        BASE::from_json(j, __VA_ARGS__); \
-    }
+        BASE::from_json(j, *this, JSON_FIELD_LIST_); \
+    } \
+    JSON_READER_METHODS_(BASE::from_json_field(r, key, *this, JSON_FIELD_LIST_, table)) \
+    JSON_BINARY_READER_METHODS_(BASE::from_binary_fields(r, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
@@ -65,17 +81,30 @@ public: \
 #ifndef JSON_SERIALIZE_FULL_INHERIT
 #define JSON_SERIALIZE_FULL_INHERIT(PARENT_CLASS, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual Json::Value to_json() const override { \
         Json::Value j = PARENT_CLASS::to_json(); \
-        JsonSerializer::to_json(j, __VA_ARGS__); \
+        JsonSerializer::to_json(j, *this, JSON_FIELD_LIST_); \
         return j; \
     } \
+    JSON_WRITER_METHODS_(PARENT_CLASS::to_json_fields(w); \
+                         JsonSerializer::to_json_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_BINARY_WRITER_METHODS_(PARENT_CLASS::to_binary(w); \
+                                JsonSerializer::to_binary_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_DELTA_WRITER_METHODS_(PARENT_CLASS::to_json_delta_fields(w); \
+                               JsonSerializer::to_json_delta_fields(w, *this, JSON_FIELD_LIST_), \
+                               PARENT_CLASS::to_json_cached_fields(w); \
+                               JsonSerializer::to_json_cached_fields(w, *this, JSON_FIELD_LIST_)) \
     virtual void from_json(const Json::Value& j) override { \
         /* 先调用父类的 from_json 处理父类字段 */ \
         PARENT_CLASS::from_json(j); \
         /* 再处理子类字段 */ \
-        JsonDeserializer::from_json(j, __VA_ARGS__); \
-    }
+        JsonDeserializer::from_json(j, *this, JSON_FIELD_LIST_); \
+    } \
+    JSON_READER_METHODS_(JsonDeserializer::from_json_field(r, key, *this, JSON_FIELD_LIST_, table) || \
+                         PARENT_CLASS::from_json_field(r, key)) \
+    JSON_BINARY_READER_METHODS_(PARENT_CLASS::from_binary(r) && \
+                                JsonDeserializer::from_binary_fields(r, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
@@ -84,7 +113,8 @@ public: \
  * @details
  *  提供：
  *   - 对象 to_json_string()
- *   - 从 JSON 创建对象 from_json()
+ *   - 从 JSON 创建对象 create_from_json()
+ *   - 从 JSON 文本创建对象 / 对象数组 from_json_string() / from_json_array_string()
  *   - 从 JSON 数组创建对象数组 from_json_array()
  *   - 将对象数组序列化为 JSON 字符串 to_json_string(vector)
  */
@@ -98,20 +128,20 @@ public: \
         return Json::writeString(builder, j); \
     } \
     /** 从 JSON 创建单个对象 */ \
-    static std::optional<CLASS_NAME> from_json(const Json::Value& j) { \
+    static std::optional<CLASS_NAME> create_from_json(const Json::Value& j) { \
         if (j.isNull()) return std::nullopt; \
-        CLASS_NAME obj; \
-        obj.from_json(j); \
+        std::optional<CLASS_NAME> obj(std::in_place); \
+        static_cast<JsonDeserializer&>(*obj).from_json(j); \
         return obj; \
     } \
     /** 从 JSON 数组创建对象数组 */ \
     static std::vector<CLASS_NAME> from_json_array(const Json::Value& j) { \
         std::vector<CLASS_NAME> objects; \
         if (!j.isArray()) return objects; \
+        objects.reserve(j.size()); \
         for (const auto& item : j) { \
-            CLASS_NAME obj; \
-            obj.from_json(item); \
-            objects.push_back(std::move(obj)); \
+            objects.emplace_back(); \
+            static_cast<JsonDeserializer&>(objects.back()).from_json(item); \
         } \
         return objects; \
     } \
@@ -123,5 +153,7 @@ public: \
         } \
         Json::StreamWriterBuilder builder; \
         return Json::writeString(builder, arr); \
-    }
+    } \
+    JSON_COMPACT_METHODS_(CLASS_NAME) \
+    JSON_PARSE_METHODS_(CLASS_NAME)
 #endif
@@ -12,8 +12,14 @@
 #include <iostream>
 #include <jsoncpp/json/json.h>
 #include <type_traits>
+#include <string_view>
 #include "JsonSerializable/TypeTraits.h"
+#include "JsonSerializable/JsonWriter.hpp"
+#include "JsonSerializable/JsonBinaryWriter.hpp"
+#include "JsonSerializable/JsonParallel.hpp"
 #include "JsonSerializable/FieldMacros.h"
+#include "JsonSerializable/JsonFieldList.hpp"
+#include "JsonSerializable/JsonDirtyState.hpp"
 
 /**
  * @brief JSON 序列化基类
@@ -22,6 +28,15 @@
  * 1. 继承 JsonSerializer。
  * 2. 重载 to_json() 或使用宏自动生成序列化函数。
  * 3. 调用 to_json() 或 to_json_string() 获取 JSON 对象或字符串。
+ *
+ * 流式路径：JSON_SERIALIZE* 宏同时生成 to_json(JsonWriter&)，
+ * 由 write_json() / to_json_compact() 直接输出紧凑 JSON，不构建 Json::Value。
+ *
+ * 二进制路径：JSON_SERIALIZE* 宏同时生成 to_binary(JsonBinaryWriter&)，
+ * 由 write_binary() 按同一 FIELD_PAIR 列表输出紧凑二进制编码（见 JsonBinaryWriter.hpp）。
+ *
+ * 增量路径：声明了 JSON_DIRTY_TRACKING 的类由 to_json_delta() 只输出修改过的字段，
+ * to_json_cached() 只重新生成修改过的字段（见 JsonDirtyState.hpp）。
  */
 class JsonSerializer {
 public:
@@ -33,36 +48,314 @@ public:
      */
     virtual Json::Value to_json() const { return Json::Value(); }
 
+    /**
+     * @brief 将对象以流式方式写入 JsonWriter
+     * @param w 写入器
+     * @details 宏生成的类直接写出各字段；只重载了 to_json() 的类经 DOM 回退
+     */
+    virtual void to_json(JsonWriter& w) const {
+        w.BeginObject();
+        to_json_fields(w);
+        w.EndObject();
+    }
+
+    /**
+     * @brief 写出对象的全部字段（不含外层花括号）
+     * @param w 写入器
+     * @details 默认实现把 to_json() 的结果逐个成员写出；继承宏借此先写父类字段
+     */
+    virtual void to_json_fields(JsonWriter& w) const {
+        Json::Value j = to_json();
+        if (!j.isObject()) return;
+        for (auto it = j.begin(); it != j.end(); ++it) {
+            w.Key(it.name());
+            w.Value(*it);
+        }
+    }
+
+    /**
+     * @brief 以紧凑格式把对象追加到 out
+     * @param out 输出缓冲区，可跨调用复用（不会被清空）
+     */
+    void write_json(std::string& out) const {
+        JsonWriter w(out);
+        to_json(w);
+    }
+
+    /**
+     * @brief 写出自上次调用以来修改过的字段（不含外层花括号），并清空修改记录
+     * @param w 写入器
+     * @details 默认实现写出全部字段；JSON_DIRTY_TRACKING 的类只写出修改过的字段
+     */
+    virtual void to_json_delta_fields(JsonWriter& w) {
+        to_json_fields(w);
+    }
+
+    /**
+     * @brief 写出全部字段（不含外层花括号），未修改的字段拼接缓存文本
+     * @param w 写入器
+     * @details 默认实现等同 to_json_fields(w)；JSON_DIRTY_TRACKING 的类重新生成修改过的字段并更新缓存
+     */
+    virtual void to_json_cached_fields(JsonWriter& w) {
+        to_json_fields(w);
+    }
+
+    /**
+     * @brief 以紧凑格式把修改过的字段追加到 out，并清空修改记录
+     * @details 已重置的字段写为 null；另一端以 JsonDeserializer::apply_json_delta() 应用
+     */
+    void write_json_delta(std::string& out) {
+        JsonWriter w(out);
+        w.BeginObject();
+        to_json_delta_fields(w);
+        w.EndObject();
+    }
+
+    std::string to_json_delta() {
+        std::string out;
+        write_json_delta(out);
+        return out;
+    }
+
+    /**
+     * @brief 以紧凑格式把对象追加到 out，未修改的字段直接拼接上次写出的文本
+     * @details 输出与 write_json() 相同
+     */
+    void write_json_cached(std::string& out) {
+        JsonWriter w(out);
+        w.BeginObject();
+        to_json_cached_fields(w);
+        w.EndObject();
+    }
+
+    std::string to_json_cached() {
+        std::string out;
+        write_json_cached(out);
+        return out;
+    }
+
+    /**
+     * @brief 将对象以紧凑二进制编码写入 JsonBinaryWriter
+     * @param w 写入器
+     * @details 宏生成的类按 FIELD_PAIR 列表写出字段块；只重载了 to_json() 的类写成自描述的 Json::Value
+     */
+    virtual void to_binary(JsonBinaryWriter& w) const {
+        w.Value(to_json());
+    }
+
+    /**
+     * @brief 以紧凑二进制编码把对象追加到 out
+     * @param out 输出缓冲区，可跨调用复用（不会被清空）
+     */
+    void write_binary(std::vector<std::byte>& out) const {
+        JsonBinaryWriter w(out);
+        to_binary(w);
+    }
+
     // ========================= 可选类型序列化 =========================
 
     /**
-     * @brief 将多个可选字段序列化到 JSON 对象
-     * @tparam T 第一个字段类型
-     * @tparam Args 剩余字段类型
+     * @brief 将字段表中已设置的字段序列化到 JSON 对象
+     * @tparam Self 字段所属对象类型
+     * @tparam Fields 字段描述类型
      * @param j JSON 对象引用
-     * @param name 当前字段名称
-     * @param value 当前字段的可选值指针
-     * @param args 其他字段参数包
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     */
+    template<typename Self, typename... Fields>
+    void to_json(Json::Value& j, const Self& self, const JsonFieldList<Fields...>& fields) const {
+        fields.ForEach([&](const auto& field) {
+            const auto& value = self.*field.member;
+            if (!value.has_value()) return;
+            *j.demand(field.name.data(), field.name.data() + field.name.size()) = to_json_value(*value);
+        });
+    }
+
+    /**
+     * @brief 旧接口：按 (字段名, 字段指针, ...) 参数包序列化到 JSON 对象
+     * @deprecated FIELD_PAIR 已改为成员指针，JSON_* 宏改用上面的字段表版本；
+     * 手写的 to_json(j, "id", &_id, ...) 调用仍可编译，建议改用 JSON_SERIALIZE* 宏
      */
     template<typename T, typename... Args>
-    void to_json(Json::Value& j, std::string name, const std::optional<T>* value, Args... args) const {
-        to_json(j, name, value);
-        to_json(j, args...);
+    [[deprecated("use the JSON_SERIALIZE* macros (field-table to_json)")]]
+    void to_json(Json::Value& j, std::string_view name, const std::optional<T>* value, Args... args) const {
+        to_json_pairs(j, name, value, args...);
+    }
+
+private:
+    template<typename T, typename... Args>
+    void to_json_pairs(Json::Value& j, std::string_view name, const std::optional<T>* value, Args... args) const {
+        if (value != nullptr && value->has_value()) {
+            *j.demand(name.data(), name.data() + name.size()) = to_json_value(**value);
+        }
+        if constexpr (sizeof...(Args) > 0) to_json_pairs(j, args...);
     }
 
+public:
+    // ========================= 流式序列化 =========================
+
     /**
-     * @brief 将单个可选字段序列化到 JSON 对象
-     * @tparam T 字段类型
-     * @param j JSON 对象引用
-     * @param name 字段名称
-     * @param value 字段的可选值指针
+     * @brief 将字段表中已设置的字段写入 JsonWriter
+     * @tparam Self 字段所属对象类型
+     * @tparam Fields 字段描述类型
+     * @param w 写入器
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     */
+    template<typename Self, typename... Fields>
+    void to_json_fields(JsonWriter& w, const Self& self, const JsonFieldList<Fields...>& fields) const {
+        fields.ForEach([&](const auto& field) {
+            const auto& value = self.*field.member;
+            if (!value.has_value()) return;
+            w.Key(field.name);
+            write_json_value(w, *value);
+        });
+    }
+
+    /**
+     * @brief 写出字段表中修改过的字段并清空 self 本层的修改记录
+     * @tparam Self 字段所属对象类型；未声明 JSON_DIRTY_TRACKING 时写出全部字段
+     * @param w 写入器
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     * @details 修改后已重置的字段写为 null
+     */
+    template<typename Self, typename... Fields>
+    void to_json_delta_fields(JsonWriter& w, Self& self, const JsonFieldList<Fields...>& fields) const {
+        if constexpr (is_json_dirty_tracked<Self>::value) {
+            JsonDirtyState& state = self.Self::json_dirty_state_();
+            if (!state.Any()) return;
+            size_t index = 0;
+            fields.ForEach([&](const auto& field) {
+                if (state.Dirty(index++)) {
+                    const auto& value = self.*field.member;
+                    w.Key(field.name);
+                    if (value.has_value()) write_json_value(w, *value);
+                    else w.Null();
+                }
+            });
+            state.ClearDirty();
+        } else {
+            to_json_fields(w, self, fields);
+        }
+    }
+
+    /**
+     * @brief 写出字段表中已设置的字段，缓存有效的字段直接拼接缓存文本
+     * @tparam Self 字段所属对象类型；未声明 JSON_DIRTY_TRACKING 时等同 to_json_fields
+     * @param w 写入器
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     */
+    template<typename Self, typename... Fields>
+    void to_json_cached_fields(JsonWriter& w, Self& self, const JsonFieldList<Fields...>& fields) const {
+        if constexpr (is_json_dirty_tracked<Self>::value) {
+            JsonDirtyState& state = self.Self::json_dirty_state_();
+            size_t index = 0;
+            fields.ForEach([&](const auto& field) {
+                size_t i = index++;
+                const auto& value = self.*field.member;
+                if (!value.has_value()) return;
+                std::string& fragment = state.Fragment(i);
+                if (!state.Cached(i)) {
+                    fragment.clear();
+                    JsonWriter fw(fragment);
+                    write_json_value(fw, *value);
+                    state.SetCached(i);
+                }
+                w.Key(field.name);
+                w.Raw(fragment);
+            });
+        } else {
+            to_json_fields(w, self, fields);
+        }
+    }
+
+    /**
+     * @brief 将任意支持类型写入 JsonWriter
+     * @tparam T 类型
+     * @param w 写入器
+     * @param value 待写入的值
+     * @details 支持的类型与 to_json_value 相同
+     */
+    template<typename T>
+    void write_json_value(JsonWriter& w, const T& value) const {
+        if constexpr (std::is_base_of_v<JsonSerializer, T>) {
+            static_cast<const JsonSerializer&>(value).to_json(w);
+        } else if constexpr (is_sequence_container<T>::value || is_set_container<T>::value) {
+            w.BeginArray();
+            for (const auto& e : value) write_json_value(w, e);
+            w.EndArray();
+        } else if constexpr (is_associative_container<T>::value) {
+            w.BeginObject();
+            for (const auto& pair : value) {
+                using K = std::decay_t<decltype(pair.first)>;
+                if constexpr (std::is_integral_v<K>) {
+                    char buf[24];
+                    auto r = std::to_chars(buf, buf + sizeof(buf), pair.first);
+                    w.Key(std::string_view(buf, static_cast<size_t>(r.ptr - buf)));
+                } else if constexpr (is_string<K>::value) {
+                    w.Key(pair.first);
+                } else {
+                    w.Key(to_string(pair.first));
+                }
+                write_json_value(w, pair.second);
+            }
+            w.EndObject();
+        } else {
+            w.Value(value);
+        }
+    }
+
+    // ========================= 二进制序列化 =========================
+
+    /**
+     * @brief 写出一层字段块：字段数、存在位图、已设置的字段值
+     * @tparam Self 字段所属对象类型
+     * @tparam Fields 字段描述类型
+     * @param w 写入器
+     * @param self 字段所属对象
+     * @param fields 由 FIELD_PAIR 列表生成的编译期字段表
+     */
+    template<typename Self, typename... Fields>
+    void to_binary_fields(JsonBinaryWriter& w, const Self& self, const JsonFieldList<Fields...>& fields) const {
+        constexpr size_t count = JsonFieldList<Fields...>::size;
+        w.Varint(count);
+        size_t bitmap = w.Reserve((count + 7) / 8);
+        size_t index = 0;
+        fields.ForEach([&](const auto& field) {
+            const auto& value = self.*field.member;
+            if (value.has_value()) {
+                w.SetBit(bitmap, index);
+                write_binary_value(w, *value);
+            }
+            ++index;
+        });
+    }
+
+    /**
+     * @brief 将任意支持类型写入 JsonBinaryWriter
+     * @tparam T 类型
+     * @param w 写入器
+     * @param value 待写入的值
+     * @details 支持的类型与 to_json_value 相同；容器先写元素数
      */
     template<typename T>
-    void to_json(Json::Value& j, std::string name, const std::optional<T>* value) const {
-        if (value == nullptr || !value->has_value()) {
-            return;
+    void write_binary_value(JsonBinaryWriter& w, const T& value) const {
+        if constexpr (std::is_base_of_v<JsonSerializer, T>) {
+            static_cast<const JsonSerializer&>(value).to_binary(w);
+        } else if constexpr (is_sequence_container<T>::value || is_set_container<T>::value) {
+            w.Varint(value.size());
+            for (const auto& e : value) write_binary_value(w, e);
+        } else if constexpr (is_associative_container<T>::value) {
+            w.Varint(value.size());
+            for (const auto& pair : value) {
+                write_binary_value(w, pair.first);
+                write_binary_value(w, pair.second);
+            }
+        } else {
+            w.Value(value);
         }
-        j[name] = to_json_value(value->value());
     }
 
     // ========================= 辅助方法 =========================
@@ -94,6 +387,8 @@ public:
                 obj[key] = to_json_value(pair.second);
             }
             return obj;
+        } else if constexpr (is_string<T>::value) {
+            return Json::Value(value.data(), value.data() + value.size());
         } else {
             return Json::Value(value);
         }
@@ -111,6 +406,8 @@ public:
             return std::to_string(key);
         } else if constexpr (std::is_same_v<K, std::string>) {
             return key;
+        } else if constexpr (is_string<K>::value) {
+            return std::string(key.data(), key.size());
         } else {
             return std::to_string(key);
         }
@@ -140,13 +437,59 @@ public:
             }
             return obj;
         } else {
-            return Json::Value(value.value());
+            return to_json_value(value.value());
         }
     }
 };
 
 // ========================= 宏定义 =========================
 
+/**
+ * @brief 生成流式序列化所需的两个重载（供 JSON_SERIALIZE* 宏内部使用）
+ * @param WRITE_FIELDS 写出字段的语句，其中写入器名为 w、本类字段表为 JSON_FIELD_LIST_
+ * @details 派生类声明 to_json() 会隐藏基类的 to_json(JsonWriter&)，因此在派生类中重新声明
+ */
+#ifndef JSON_WRITER_METHODS_
+#define JSON_WRITER_METHODS_(WRITE_FIELDS) \
+    virtual void to_json(JsonWriter& w) const override { \
+        w.BeginObject(); to_json_fields(w); w.EndObject(); \
+    } \
+    virtual void to_json_fields(JsonWriter& w) const override { \
+        WRITE_FIELDS; \
+    }
+#endif
+
+/**
+ * @brief 生成增量 / 缓存序列化重载与字段下标查找（供 JSON_SERIALIZE* 宏内部使用）
+ * @param DELTA_FIELDS 写出修改过的字段的语句，其中写入器名为 w、本类字段表为 JSON_FIELD_LIST_
+ * @param CACHED_FIELDS 以缓存写出字段的语句
+ * @details json_field_index_ 供 JSON_DIRTY_TRACKING 把成员指针映射为修改位下标
+ */
+#ifndef JSON_DELTA_WRITER_METHODS_
+#define JSON_DELTA_WRITER_METHODS_(DELTA_FIELDS, CACHED_FIELDS) \
+    virtual void to_json_delta_fields(JsonWriter& w) override { \
+        DELTA_FIELDS; \
+    } \
+    virtual void to_json_cached_fields(JsonWriter& w) override { \
+        CACHED_FIELDS; \
+    } \
+    template<typename Member> \
+    int json_field_index_(Member member) const { \
+        return JSON_FIELD_LIST_.IndexOf(member); \
+    }
+#endif
+
+/**
+ * @brief 生成二进制序列化重载（供 JSON_SERIALIZE* 宏内部使用）
+ * @param WRITE_FIELDS 写出字段块的语句，其中写入器名为 w、本类字段表为 JSON_FIELD_LIST_
+ */
+#ifndef JSON_BINARY_WRITER_METHODS_
+#define JSON_BINARY_WRITER_METHODS_(WRITE_FIELDS) \
+    virtual void to_binary(JsonBinaryWriter& w) const override { \
+        WRITE_FIELDS; \
+    }
+#endif
+
 /**
  * @brief 自动生成 JSON 序列化函数宏
  * @param BASE 父类名
@@ -156,9 +499,14 @@ public:
 #ifndef JSON_SERIALIZE
 #define JSON_SERIALIZE(BASE, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual Json::Value to_json() const override { \
-        Json::Value j; BASE::to_json(j, __VA_ARGS__); return j; \
-    }
+        Json::Value j; BASE::to_json(j, *this, JSON_FIELD_LIST_); return j; \
+    } \
+    JSON_WRITER_METHODS_(BASE::to_json_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_BINARY_WRITER_METHODS_(BASE::to_binary_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_DELTA_WRITER_METHODS_(BASE::to_json_delta_fields(w, *this, JSON_FIELD_LIST_), \
+                               BASE::to_json_cached_fields(w, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
@@ -169,9 +517,14 @@ public: \
 #ifndef JSON_SERIALIZE_WITH_PARENT
 #define JSON_SERIALIZE_WITH_PARENT(BASE, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual Json::Value to_json() const override { \
-        Json::Value j; BASE::to_json(j, __VA_ARGS__); return j; \
-    }
+        Json::Value j; BASE::to_json(j, *this, JSON_FIELD_LIST_); return j; \
+    } \
+    JSON_WRITER_METHODS_(BASE::to_json_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_BINARY_WRITER_METHODS_(BASE::to_binary_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_DELTA_WRITER_METHODS_(BASE::to_json_delta_fields(w, *this, JSON_FIELD_LIST_), \
+                               BASE::to_json_cached_fields(w, *this, JSON_FIELD_LIST_))
 #endif
 
 /**
@@ -182,10 +535,57 @@ public: \
 #ifndef JSON_SERIALIZE_INHERIT
 #define JSON_SERIALIZE_INHERIT(PARENT_CLASS, ...) \
 public: \
+    JSON_FIELDS_(__VA_ARGS__) \
     virtual Json::Value to_json() const override { \
         Json::Value j = PARENT_CLASS::to_json(); \
-        JsonSerializer::to_json(j, __VA_ARGS__); \
+        JsonSerializer::to_json(j, *this, JSON_FIELD_LIST_); \
         return j; \
+    } \
+    JSON_WRITER_METHODS_(PARENT_CLASS::to_json_fields(w); \
+                         JsonSerializer::to_json_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_BINARY_WRITER_METHODS_(PARENT_CLASS::to_binary(w); \
+                                JsonSerializer::to_binary_fields(w, *this, JSON_FIELD_LIST_)) \
+    JSON_DELTA_WRITER_METHODS_(PARENT_CLASS::to_json_delta_fields(w); \
+                               JsonSerializer::to_json_delta_fields(w, *this, JSON_FIELD_LIST_), \
+                               PARENT_CLASS::to_json_cached_fields(w); \
+                               JsonSerializer::to_json_cached_fields(w, *this, JSON_FIELD_LIST_))
+#endif
+
+/**
+ * @brief 紧凑 JSON 字符串方法（流式，不构建 Json::Value）
+ * @param CLASS_NAME 类名
+ * @details 提供：
+ *  - 成员对象 to_json_compact()
+ *  - 对象数组 std::vector<CLASS_NAME> 的 to_json_compact()
+ *  - 对象数组的并行版本 to_json_compact(objects, executor, chunkSize)：
+ *    每 chunkSize 个对象写入独立缓冲区，全部完成后按块顺序拼接，输出与串行版本逐字节相同
+ */
+#ifndef JSON_COMPACT_METHODS_
+#define JSON_COMPACT_METHODS_(CLASS_NAME) \
+    std::string to_json_compact() const { \
+        std::string out; write_json(out); return out; \
+    } \
+    static std::string to_json_compact(const std::vector<CLASS_NAME>& objects) { \
+        std::string out; \
+        JsonWriter w(out); \
+        w.BeginArray(); \
+        for (const auto& obj : objects) { \
+            static_cast<const JsonSerializer&>(obj).to_json(w); \
+        } \
+        w.EndArray(); \
+        return out; \
+    } \
+    template<typename Executor, typename = typename JsonExecutorTask<Executor>::type> \
+    static std::string to_json_compact(const std::vector<CLASS_NAME>& objects, Executor& executor, \
+                                       size_t chunkSize = 1024) { \
+        std::vector<std::string> parts(JsonChunkCount(objects.size(), chunkSize)); \
+        JsonParallelFor(executor, objects.size(), chunkSize, [&](size_t chunk, size_t begin, size_t end) { \
+            JsonWriter w(parts[chunk]); \
+            for (size_t i = begin; i < end; ++i) { \
+                static_cast<const JsonSerializer&>(objects[i]).to_json(w); \
+            } \
+        }); \
+        return JsonJoinArray(parts); \
     }
 #endif
 
@@ -211,5 +611,6 @@ public: \
         } \
         Json::StreamWriterBuilder builder; \
         return Json::writeString(builder, arr); \
-    }
+    } \
+    JSON_COMPACT_METHODS_(CLASS_NAME)
 #endif
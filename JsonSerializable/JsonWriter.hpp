@@ -0,0 +1,163 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <cmath>
+#include <type_traits>
+#include <jsoncpp/json/json.h>
+
+/**
+ * @brief 流式 JSON 写入器
+ * @details 直接把紧凑格式的 JSON 追加到调用者提供的 std::string，不构建 Json::Value DOM。
+ * - 缓冲区由调用者持有，可跨多次序列化复用容量（写入前自行 clear()）
+ * - 逗号由写入器自动插入：上一个记号是值或闭合的容器时，下一个键 / 值前补 ','
+ * - 数字用 std::to_chars 输出；浮点为最短可往返表示，非有限值输出 null
+ * - 字符串按 RFC 8259 转义 '"'、'\\' 与控制字符，UTF-8 原样输出
+ *
+ * 使用方法：
+ * @code
+ *   std::string buffer;
+ *   JsonWriter w(buffer);
+ *   w.BeginObject();
+ *   w.Key("id"); w.Value(1);
+ *   w.Key("tags"); w.BeginArray(); w.Value("a"); w.EndArray();
+ *   w.EndObject();   // buffer == {"id":1,"tags":["a"]}
+ * @endcode
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out) : _out(out) {}
+
+    /**
+     * @brief 底层输出缓冲区
+     */
+    std::string& Buffer() { return _out; }
+
+    void BeginObject() { Separate(); _out.push_back('{'); _needComma = false; }
+    void EndObject()   { _out.push_back('}'); _needComma = true; }
+    void BeginArray()  { Separate(); _out.push_back('['); _needComma = false; }
+    void EndArray()    { _out.push_back(']'); _needComma = true; }
+
+    /**
+     * @brief 写入对象的键（其后必须紧跟一个值）
+     * @param name 键名；字段名为编译期字面量时长度在编译期确定
+     */
+    void Key(std::string_view name) {
+        Separate();
+        AppendString(name);
+        _out.push_back(':');
+        _needComma = false;
+    }
+
+    void Null() { Separate(); _out.append("null"); _needComma = true; }
+
+    /**
+     * @brief 原样写入一个已序列化的值（如缓存的字段文本）
+     * @param json 完整、紧凑的 JSON 值
+     */
+    void Raw(std::string_view json) { Separate(); _out.append(json); _needComma = true; }
+
+    /**
+     * @brief 写入标量值
+     * @tparam T bool、整数、浮点或可转换为 std::string_view 的字符串类型
+     */
+    template<typename T>
+    void Value(const T& value) {
+        Separate();
+        if constexpr (std::is_same_v<T, bool>) {
+            _out.append(value ? "true" : "false");
+        } else if constexpr (std::is_floating_point_v<T>) {
+            AppendDouble(static_cast<double>(value));
+        } else if constexpr (std::is_integral_v<T>) {
+            char buf[24];
+            auto r = std::to_chars(buf, buf + sizeof(buf), value);
+            _out.append(buf, static_cast<size_t>(r.ptr - buf));
+        } else {
+            AppendString(std::string_view(value));
+        }
+        _needComma = true;
+    }
+
+    /**
+     * @brief 写入一棵 Json::Value（兼容手写 to_json() 的类型）
+     */
+    void Value(const Json::Value& value) {
+        switch (value.type()) {
+            case Json::nullValue:    Null(); break;
+            case Json::intValue:     Value(value.asLargestInt()); break;
+            case Json::uintValue:    Value(value.asLargestUInt()); break;
+            case Json::realValue:    Value(value.asDouble()); break;
+            case Json::booleanValue: Value(value.asBool()); break;
+            case Json::stringValue: {
+                const char* begin = nullptr;
+                const char* end = nullptr;
+                value.getString(&begin, &end);
+                Value(std::string_view(begin, static_cast<size_t>(end - begin)));
+                break;
+            }
+            case Json::arrayValue:
+                BeginArray();
+                for (const auto& item : value) Value(item);
+                EndArray();
+                break;
+            case Json::objectValue:
+                BeginObject();
+                for (auto it = value.begin(); it != value.end(); ++it) {
+                    Key(it.name());
+                    Value(*it);
+                }
+                EndObject();
+                break;
+        }
+    }
+
+private:
+    void Separate() {
+        if (_needComma) _out.push_back(',');
+    }
+
+    void AppendDouble(double value) {
+        if (!std::isfinite(value)) {
+            _out.append("null");
+            return;
+        }
+        char buf[32];
+        auto r = std::to_chars(buf, buf + sizeof(buf), value);
+        std::string_view text(buf, static_cast<size_t>(r.ptr - buf));
+        _out.append(text);
+        // 保持浮点语义：整数值补 ".0"，与 Json::Value 的 realValue 往返一致
+        if (text.find_first_of(".e") == std::string_view::npos) _out.append(".0");
+    }
+
+    void AppendString(std::string_view s) {
+        static const char kHex[] = "0123456789abcdef";
+        _out.push_back('"');
+        size_t run = 0;
+        for (size_t i = 0; i < s.size(); ++i) {
+            unsigned char c = static_cast<unsigned char>(s[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+            _out.append(s.data() + run, i - run);
+            run = i + 1;
+            switch (c) {
+                case '"':  _out.append("\\\""); break;
+                case '\\': _out.append("\\\\"); break;
+                case '\b': _out.append("\\b"); break;
+                case '\f': _out.append("\\f"); break;
+                case '\n': _out.append("\\n"); break;
+                case '\r': _out.append("\\r"); break;
+                case '\t': _out.append("\\t"); break;
+                default: {
+                    char esc[6] = {'\\', 'u', '0', '0', kHex[c >> 4], kHex[c & 0xF]};
+                    _out.append(esc, sizeof(esc));
+                }
+            }
+        }
+        _out.append(s.data() + run, s.size() - run);
+        _out.push_back('"');
+    }
+
+    std::string& _out;
+    bool _needComma = false;
+};
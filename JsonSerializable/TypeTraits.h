@@ -7,34 +7,52 @@
 #include <map>
 #include <unordered_set>
 #include <unordered_map>
+#include <string>
+#include <memory>
+#include <memory_resource>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 /**
  * 容器类型特征定义
  * 用于在编译时识别不同类型的容器
  */
 
-// 类型特征：检查是否为序列容器
+// 类型特征：检查是否为序列容器（任意分配器，含 std::pmr 容器）
 template<typename T> struct is_sequence_container : std::false_type {};
-template<typename T> struct is_sequence_container<std::vector<T>> : std::true_type {};
-template<typename T> struct is_sequence_container<std::list<T>> : std::true_type {};
-template<typename T> struct is_sequence_container<std::deque<T>> : std::true_type {};
+template<typename T, typename A> struct is_sequence_container<std::vector<T, A>> : std::true_type {};
+template<typename T, typename A> struct is_sequence_container<std::list<T, A>> : std::true_type {};
+template<typename T, typename A> struct is_sequence_container<std::deque<T, A>> : std::true_type {};
 
 // 类型特征：检查是否为关联容器
 template<typename T> struct is_associative_container : std::false_type {};
-template<typename K, typename V> struct is_associative_container<std::map<K, V>> : std::true_type {};
-template<typename K, typename V> struct is_associative_container<std::unordered_map<K, V>> : std::true_type {};
+template<typename K, typename V, typename C, typename A>
+struct is_associative_container<std::map<K, V, C, A>> : std::true_type {};
+template<typename K, typename V, typename H, typename E, typename A>
+struct is_associative_container<std::unordered_map<K, V, H, E, A>> : std::true_type {};
 
 // 类型特征：检查是否为集合容器
 template<typename T> struct is_set_container : std::false_type {};
-template<typename T> struct is_set_container<std::set<T>> : std::true_type {};
-template<typename T> struct is_set_container<std::unordered_set<T>> : std::true_type {};
+template<typename T, typename C, typename A> struct is_set_container<std::set<T, C, A>> : std::true_type {};
+template<typename T, typename H, typename E, typename A>
+struct is_set_container<std::unordered_set<T, H, E, A>> : std::true_type {};
 
 // 通用容器类型特征
-template<typename T> struct is_container : std::false_type {};
-template<typename T> struct is_container<std::vector<T>> : std::true_type {};
-template<typename T> struct is_container<std::list<T>> : std::true_type {};
-template<typename T> struct is_container<std::deque<T>> : std::true_type {};
-template<typename T> struct is_container<std::set<T>> : std::true_type {};
-template<typename T> struct is_container<std::unordered_set<T>> : std::true_type {};
-template<typename K, typename V> struct is_container<std::map<K, V>> : std::true_type {};
-template<typename K, typename V> struct is_container<std::unordered_map<K, V>> : std::true_type {};
+template<typename T>
+struct is_container : std::bool_constant<is_sequence_container<T>::value ||
+                                         is_associative_container<T>::value ||
+                                         is_set_container<T>::value> {};
+
+// 类型特征：检查是否为 char 字符串（std::string、std::pmr::string 等）
+template<typename T> struct is_string : std::false_type {};
+template<typename Traits, typename A> struct is_string<std::basic_string<char, Traits, A>> : std::true_type {};
+
+// 类型特征：是否使用 std::pmr::polymorphic_allocator（std::pmr 字符串 / 容器）
+template<typename T>
+struct is_pmr_allocated : std::uses_allocator<T, std::pmr::polymorphic_allocator<std::byte>> {};
+
+// 类型特征：容器是否有 reserve(size_t)
+template<typename T, typename = void> struct has_reserve : std::false_type {};
+template<typename T>
+struct has_reserve<T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t{}))>> : std::true_type {};
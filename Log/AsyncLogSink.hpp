@@ -0,0 +1,453 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <string_view>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <Log/Log.hpp>
+#include <Containers/RingQueue.h>
+#include <Executor/EventCount.h>
+
+// 队列已满时的处理方式
+enum class AsyncLogOverflow {
+    Block, ///< 挂起等待写线程腾出空位（不丢日志）
+    Drop,  ///< 丢弃并计数（不阻塞调用线程）
+};
+
+// 异步日志后端配置
+struct AsyncLogSinkOptions {
+    size_t queueCapacity = 8192;                              ///< 暂存队列容量（向上取整为 2 的幂）
+    size_t maxBatch = 256;                                    ///< 单次 writev 最多合并的日志条数
+    std::chrono::milliseconds flushInterval{100};             ///< 未攒满一批时的最长落盘间隔
+    AsyncLogOverflow overflow = AsyncLogOverflow::Block;      ///< 队列满时的策略
+};
+
+/// 暂存队列元素内联正文的容量，更长的正文才会分配堆内存
+inline constexpr size_t kAsyncLogInlineText = 192;
+
+/**
+ * @class FdLogOutput
+ * @brief AsyncLogSink 的输出端：把一批日志以 writev 写入文件描述符
+ *
+ * @details
+ * 输出端接口（BasicAsyncLogSink 在持有输出锁时调用）：
+ * - Append(data, size)  追加一行；data 在下一次 Commit() 前保持有效
+ * - Commit()            一批结束
+ * - Tick()              写线程空闲醒来（flushInterval 到期）
+ *
+ * @author BUG
+ * @date 2025-12-26
+ */
+class FdLogOutput {
+public:
+    /**
+     * @brief 写入已打开的文件描述符（不接管所有权）
+     */
+    explicit FdLogOutput(int fd = STDOUT_FILENO)
+        : _fd(fd), _ownsFd(false)
+    {}
+
+    /**
+     * @brief 以追加方式打开文件并写入（接管所有权）
+     */
+    explicit FdLogOutput(const std::string& path)
+        : _fd(::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644)), _ownsFd(true)
+    {}
+
+    ~FdLogOutput() {
+        if (_ownsFd && _fd >= 0) ::close(_fd);
+    }
+
+    FdLogOutput(const FdLogOutput&) = delete;
+    FdLogOutput& operator=(const FdLogOutput&) = delete;
+
+    bool IsOpen() const {
+        return _fd >= 0;
+    }
+
+    void Append(const char* data, size_t size) {
+        _iov.push_back(iovec{const_cast<char*>(data), size});
+    }
+
+    void Commit() {
+        WriteVector(_iov.data(), _iov.size());
+        _iov.clear();
+    }
+
+    void Tick() {}
+
+private:
+    /**
+     * @brief writev 写出全部数据，处理部分写与 EINTR
+     */
+    void WriteVector(iovec* iov, size_t count) {
+        if (_fd < 0) return;
+        while (count > 0) {
+            int chunk = static_cast<int>(count < IOV_MAX ? count : IOV_MAX);
+            ssize_t written = ::writev(_fd, iov, chunk);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return;
+            }
+            size_t left = static_cast<size_t>(written);
+            while (count > 0 && left >= iov->iov_len) {
+                left -= iov->iov_len;
+                ++iov;
+                --count;
+            }
+            if (count > 0 && left > 0) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+                iov->iov_len -= left;
+            }
+        }
+    }
+
+    int _fd;
+    bool _ownsFd;
+    std::vector<iovec> _iov;
+};
+
+/**
+ * @class BasicAsyncLogSink
+ * @brief 异步、双缓冲的日志后端
+ *
+ * @details
+ * 数据流：
+ * - 前台：调用线程只拷贝日志正文并连同元数据（级别、位置、时刻）推入无锁 RingQueue（MPSC），
+ *   不做时间转换、不做格式化、不做任何 IO；
+ *   不超过 kAsyncLogInlineText 的正文直接构造在队列 slot 的内联缓冲中，不分配堆内存
+ * - 后台：写线程一次 TryPopBulk 取出至多 maxBatch 条到自己的批次缓冲，
+ *   在写线程上完成时间戳与前缀的格式化（复用行缓冲），
+ *   再逐行交给 Output（FdLogOutput 合并为 writev，MmapLogOutput 直接拷入映射区）
+ *
+ * 前台暂存队列与后台批次缓冲构成双缓冲：写线程落盘期间，前台继续写入队列。
+ *
+ * 队列已满：
+ * - AsyncLogOverflow::Block：唤醒写线程后挂起在 EventCount 上，写线程每取出一批即唤醒等待者
+ * - AsyncLogOverflow::Drop：丢弃并计入 DroppedCount()
+ *
+ * 落盘时机：
+ * - 暂存条数达到 maxBatch 时由生产者唤醒写线程
+ * - 否则写线程每隔 flushInterval 醒来一次，并调用 Output::Tick()
+ *
+ * Stop()：
+ * - 拒绝新的异步写入（之后的 Write 直接同步写出）
+ * - 等待在途的 Write 完成入队，再写出队列中剩余的全部日志，保证不丢失
+ *
+ * @tparam Output 输出端，接口见 FdLogOutput
+ * @author BUG
+ * @date 2025-12-26
+ */
+template<typename Output>
+class BasicAsyncLogSink {
+public:
+    /**
+     * @brief 构造后台与输出端
+     * @param args 转发给 Output 的构造参数
+     */
+    template<typename... Args>
+    explicit BasicAsyncLogSink(AsyncLogSinkOptions options, Args&&... args)
+        : _options(Normalize(options))
+        , _queue(_options.queueCapacity)
+        , _output(std::forward<Args>(args)...)
+    {}
+
+    ~BasicAsyncLogSink() {
+        Stop();
+    }
+
+    BasicAsyncLogSink(const BasicAsyncLogSink&) = delete;
+    BasicAsyncLogSink& operator=(const BasicAsyncLogSink&) = delete;
+
+    /**
+     * @brief 启动后台写线程，重复调用无效
+     */
+    void Start() {
+        if (_running.exchange(true)) return;
+        _writer = std::thread(&BasicAsyncLogSink::WriterLoop, this);
+    }
+
+    /**
+     * @brief 停止后台写线程并写出全部剩余日志
+     */
+    void Stop() {
+        if (!_running.exchange(false)) return;
+
+        _parking.NotifyAll();
+        if (_writer.joinable()) _writer.join();
+
+        // 写线程已退出，当前线程成为唯一消费者：
+        // 边写边等待已通过运行检查的生产者完成入队（Block 模式下它们可能正等待空位）
+        while (true) {
+            bool idle = _inFlight.load(std::memory_order_seq_cst) == 0;
+            while (Flush() > 0) {}
+            if (idle) break;
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief 提交一条日志
+     * @details 写线程按 Log::Format 的格式输出并追加换行
+     */
+    void Write(const LogData& data) {
+        if (data.content.size() <= kAsyncLogInlineText) {
+            Push(data);
+        } else {
+            // 超长正文先在 slot 之外完成堆分配，slot 内的构造不会抛出异常
+            Push(Entry(data));
+        }
+    }
+
+    /**
+     * @brief 提交一行已格式化的文本（调用者负责换行）
+     */
+    void Write(std::string line) {
+        Push(Entry(std::move(line)));
+    }
+
+    /**
+     * @brief 因队列已满而被丢弃的日志条数（仅 AsyncLogOverflow::Drop）
+     */
+    size_t DroppedCount() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @brief 暂存队列元素
+     *
+     * @details
+     * - raw 为 true 时文本仅为正文，由写线程结合 meta 格式化
+     * - 不超过 kAsyncLogInlineText 的正文存放在内联缓冲 text 中；
+     *   更长的正文与 Write(std::string) 提交的整行存放在 spill 中
+     * - 移动只拷贝内联缓冲中已使用的 size 字节
+     */
+    struct Entry {
+        LogData meta{};
+        std::string spill;
+        uint32_t size = 0;
+        bool raw = false;
+        char text[kAsyncLogInlineText];
+
+        Entry() = default;
+
+        explicit Entry(const LogData& data)
+            : meta(data), raw(true)
+        {
+            meta.content = {};
+            if (data.content.size() <= kAsyncLogInlineText) {
+                size = static_cast<uint32_t>(data.content.size());
+                std::memcpy(text, data.content.data(), size);
+            } else {
+                spill.assign(data.content);
+            }
+        }
+
+        explicit Entry(std::string&& line) noexcept
+            : spill(std::move(line))
+        {}
+
+        Entry(Entry&& other) noexcept
+            : meta(other.meta), spill(std::move(other.spill)), size(other.size), raw(other.raw)
+        {
+            std::memcpy(text, other.text, size);
+        }
+
+        Entry& operator=(Entry&& other) noexcept {
+            meta = other.meta;
+            spill = std::move(other.spill);
+            size = other.size;
+            raw = other.raw;
+            std::memcpy(text, other.text, size);
+            return *this;
+        }
+
+        std::string_view Text() const {
+            return size > 0 ? std::string_view(text, size) : std::string_view(spill);
+        }
+    };
+
+    /**
+     * @brief 入队一条日志，args 为 Entry 的构造参数
+     * @details 只在入队成功时消费 args（RingQueue::TryEmplace），失败重试时 args 保持不变
+     */
+    template<typename Arg>
+    void Push(Arg&& arg) {
+        _inFlight.fetch_add(1, std::memory_order_seq_cst);
+        if (!_running.load(std::memory_order_seq_cst)) {
+            _inFlight.fetch_sub(1, std::memory_order_release);
+            WriteNow(Entry(std::forward<Arg>(arg)));
+            return;
+        }
+
+        RingQueueResult r;
+        while ((r = _queue.TryEmplace(std::forward<Arg>(arg))) != RingQueueResult::Ok) {
+            if (r == RingQueueResult::Busy) {
+                CpuRelax();
+                continue;
+            }
+            _parking.NotifyOne();
+            if (_options.overflow == AsyncLogOverflow::Drop) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+            // 登记后重试一次：写线程若在登记前已腾出空位，这里直接成功，不会错过唤醒
+            auto key = _space.PrepareWait();
+            if ((r = _queue.TryEmplace(std::forward<Arg>(arg))) == RingQueueResult::Ok) {
+                _space.CancelWait();
+                break;
+            }
+            _space.Wait(key);
+        }
+        _inFlight.fetch_sub(1, std::memory_order_release);
+
+        if (r == RingQueueResult::Ok && _queue.SizeApprox() >= _options.maxBatch) {
+            _parking.NotifyOne();
+        }
+    }
+
+    /**
+     * @brief 写线程未运行时在调用线程同步写出
+     */
+    void WriteNow(Entry&& entry) {
+        std::string line;
+        std::string_view out = Render(entry, line);
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        _output.Append(out.data(), out.size());
+        _output.Commit();
+    }
+
+    /**
+     * @brief 得到 entry 的输出文本
+     * @return 已格式化的 entry 直接返回其文本，否则格式化到 line 并返回 line
+     */
+    static std::string_view Render(Entry& entry, std::string& line) {
+        if (!entry.raw) return entry.Text();
+        entry.meta.content = entry.Text();
+        line.clear();
+        Log::Format(entry.meta, line);
+        line.push_back('\n');
+        return line;
+    }
+
+    static AsyncLogSinkOptions Normalize(AsyncLogSinkOptions options) {
+        if (options.queueCapacity == 0) options.queueCapacity = 1;
+        if (options.maxBatch == 0) options.maxBatch = 1;
+        // 一批不能超过队列容量，否则队列写满也达不到唤醒写线程的条数
+        if (options.maxBatch > options.queueCapacity) options.maxBatch = options.queueCapacity;
+        return options;
+    }
+
+    /**
+     * @brief 后台写线程
+     * @details 有数据就写；不足一批时最多等待 flushInterval
+     */
+    void WriterLoop() {
+        while (true) {
+            Flush();
+
+            if (!_running.load(std::memory_order_acquire)) break;
+            if (_queue.SizeApprox() >= _options.maxBatch) continue;
+
+            auto key = _parking.PrepareWait();
+            if (_queue.SizeApprox() >= _options.maxBatch || !_running.load(std::memory_order_acquire)) {
+                _parking.CancelWait();
+                continue;
+            }
+            if (!_parking.WaitFor(key, _options.flushInterval)) {
+                std::lock_guard<std::mutex> lock(_outputMutex);
+                _output.Tick();
+            }
+        }
+    }
+
+    /**
+     * @brief 取出一批日志并写出
+     * @return 写出的日志条数
+     */
+    size_t Flush() {
+        size_t n = _queue.TryPopBulk(std::back_inserter(_batch), _options.maxBatch);
+        if (n == 0) return 0;
+        _space.NotifyAll();
+
+        if (_lines.size() < _batch.size()) _lines.resize(_batch.size());
+
+        {
+            std::lock_guard<std::mutex> lock(_outputMutex);
+            for (size_t i = 0; i < _batch.size(); ++i) {
+                std::string_view out = Render(_batch[i], _lines[i]);
+                _output.Append(out.data(), out.size());
+            }
+            _output.Commit();
+        }
+        _batch.clear();
+        return n;
+    }
+
+    AsyncLogSinkOptions _options;
+    RingQueue<Entry, Producers::Multi, Consumers::Single> _queue; ///< 前台暂存
+    std::vector<Entry> _batch;                                    ///< 后台批次缓冲（仅写线程）
+    std::vector<std::string> _lines;                              ///< 格式化行缓冲（仅写线程，复用容量）
+
+    std::atomic<bool> _running{false};
+    alignas(kCacheLineSize) std::atomic<size_t> _inFlight{0};
+    std::atomic<size_t> _dropped{0};
+    EventCount _parking;  ///< 写线程等待数据
+    EventCount _space;    ///< Block 模式下生产者等待空位
+    std::thread _writer;
+
+protected:
+    std::mutex _outputMutex; ///< 串行化写线程与 Stop 后同步写入对 Output 的访问
+    Output _output;
+};
+
+/**
+ * @class AsyncLogSink
+ * @brief 写入文件或 fd 的异步日志后端（writev）
+ *
+ * @code
+ *   AsyncLogSink sink("app.log");
+ *   sink.Start();
+ *   Log::SetLogWriterFunc([&](const LogData& d) { sink.Write(d); });
+ *   LOGI() << "hello";
+ *   sink.Stop();
+ * @endcode
+ *
+ * @author BUG
+ * @date 2025-12-26
+ */
+class AsyncLogSink : public BasicAsyncLogSink<FdLogOutput> {
+public:
+    /**
+     * @brief 写入已打开的文件描述符（不接管所有权）
+     */
+    explicit AsyncLogSink(int fd = STDOUT_FILENO, AsyncLogSinkOptions options = {})
+        : BasicAsyncLogSink(options, fd)
+    {}
+
+    /**
+     * @brief 以追加方式打开文件并写入（接管所有权）
+     */
+    explicit AsyncLogSink(const std::string& path, AsyncLogSinkOptions options = {})
+        : BasicAsyncLogSink(options, path)
+    {}
+
+    /**
+     * @brief 文件是否成功打开
+     */
+    bool IsOpen() const {
+        return _output.IsOpen();
+    }
+};
@@ -0,0 +1,461 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
+#include <string_view>
+#include <Log/Log.hpp>
+#include <Log/AsyncLogSink.hpp>
+#include <Containers/RingQueue.h>
+#include <Executor/EventCount.h>
+
+// 单条二进制日志记录可携带的参数字节数
+#ifndef BINARY_LOG_PAYLOAD
+    #define BINARY_LOG_PAYLOAD 200
+#endif
+
+// 宏定义：与 LOGI() 等相同的级别门限，但只把参数的原始值写入二进制记录，
+// 格式化推迟到 BinaryLogBackend 的后台线程
+#define LOG_BINARY_STATEMENT_(type) \
+    !Log::IsEnabled(type) ? (void)0 : LogVoidify() & BinaryLog(type, __FILE__, __func__, __LINE__)
+
+#ifndef LOGBI
+    #define LOGBI() LOG_BINARY_STATEMENT_(LOG_TYPE::INFO)
+#endif
+
+#ifndef LOGBE
+    #define LOGBE() LOG_BINARY_STATEMENT_(LOG_TYPE::ERROR)
+#endif
+
+#ifndef LOGBW
+    #define LOGBW() LOG_BINARY_STATEMENT_(LOG_TYPE::WARN)
+#endif
+
+#ifndef LOGBD
+    #define LOGBD() LOG_BINARY_STATEMENT_(LOG_TYPE::DEBUG)
+#endif
+
+// 参数类型标签
+enum class BINARY_LOG_TAG : uint8_t {
+    INT,        // int64_t
+    UINT,       // uint64_t
+    DOUBLE,     // double
+    BOOL,       // uint8_t
+    CHAR,       // char
+    STRING,     // uint16_t 长度 + 字节
+    LIST,       // uint16_t 元素数 + 元素
+    MAP,        // uint16_t 键值对数 + (键, 值)...
+};
+
+/**
+ * @brief 二进制日志记录
+ *
+ * @details
+ * 定长，直接作为 RingQueue 的 slot 元素。
+ * payload 中依次存放 [tag][value]，容纳不下的参数被丢弃并置 truncated。
+ * 拷贝只复制记录头与 payload 中已使用的 size 字节，入队开销与参数长度成正比。
+ */
+struct BinaryLogRecord {
+    BinaryLogRecord() = default;
+
+    BinaryLogRecord(const BinaryLogRecord& other) {
+        CopyFrom(other);
+    }
+
+    BinaryLogRecord& operator=(const BinaryLogRecord& other) {
+        if (this != &other) CopyFrom(other);
+        return *this;
+    }
+
+    void CopyFrom(const BinaryLogRecord& other) {
+        std::memcpy(static_cast<void*>(this), &other, offsetof(BinaryLogRecord, payload) + other.size);
+    }
+
+    LOG_TYPE type;
+    int line;
+    const char* file;
+    const char* function;
+    std::chrono::system_clock::time_point time;
+    uint16_t size = 0;
+    bool truncated = false;
+    unsigned char payload[BINARY_LOG_PAYLOAD];
+};
+
+/**
+ * @brief 把 BinaryLogRecord 解码为与 Log 相同的文本正文
+ *
+ * @details
+ * 可在消费线程上调用，也可用于离线解码转储的记录。
+ * 输出与 Log 的 operator<< 一致：标量 "v "，容器 "{a, b} "，KV 容器 "MAP:{[k,v]} "
+ */
+class BinaryLogDecoder {
+public:
+    static void Decode(const BinaryLogRecord& record, std::string& out) {
+        const unsigned char* p = record.payload;
+        const unsigned char* end = record.payload + record.size;
+
+        while (p < end) {
+            auto tag = static_cast<BINARY_LOG_TAG>(*p++);
+            if (tag == BINARY_LOG_TAG::LIST) {
+                uint16_t count = Read<uint16_t>(p);
+                out.push_back('{');
+                for (uint16_t i = 0; i < count; ++i) {
+                    if (i) out.append(", ");
+                    DecodeScalar(p, out);
+                }
+                out.append("} ");
+            } else if (tag == BINARY_LOG_TAG::MAP) {
+                uint16_t count = Read<uint16_t>(p);
+                out.append("MAP:{");
+                for (uint16_t i = 0; i < count; ++i) {
+                    if (i) out.append(", ");
+                    out.push_back('[');
+                    DecodeScalar(p, out);
+                    out.push_back(',');
+                    DecodeScalar(p, out);
+                    out.push_back(']');
+                }
+                out.append("} ");
+            } else {
+                DecodeValue(tag, p, out);
+                out.push_back(' ');
+            }
+        }
+
+        if (record.truncated) out.append("...");
+    }
+
+private:
+    template <typename T>
+    static T Read(const unsigned char*& p) {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return value;
+    }
+
+    static void DecodeScalar(const unsigned char*& p, std::string& out) {
+        auto tag = static_cast<BINARY_LOG_TAG>(*p++);
+        DecodeValue(tag, p, out);
+    }
+
+    static void DecodeValue(BINARY_LOG_TAG tag, const unsigned char*& p, std::string& out) {
+        switch (tag) {
+            case BINARY_LOG_TAG::INT:    Log::AppendNumber(out, Read<int64_t>(p)); break;
+            case BINARY_LOG_TAG::UINT:   Log::AppendNumber(out, Read<uint64_t>(p)); break;
+            case BINARY_LOG_TAG::DOUBLE: Log::AppendNumber(out, Read<double>(p)); break;
+            case BINARY_LOG_TAG::BOOL:   out.push_back(Read<uint8_t>(p) ? '1' : '0'); break;
+            case BINARY_LOG_TAG::CHAR:   out.push_back(Read<char>(p)); break;
+            case BINARY_LOG_TAG::STRING: {
+                uint16_t length = Read<uint16_t>(p);
+                out.append(reinterpret_cast<const char*>(p), length);
+                p += length;
+                break;
+            }
+            default: break;
+        }
+    }
+};
+
+// 二进制日志后端配置
+struct BinaryLogOptions {
+    size_t queueCapacity = 16384;                         ///< 记录环形队列容量
+    size_t wakeThreshold = 256;                           ///< 积压达到该值时唤醒后台线程
+    std::chrono::milliseconds flushInterval{50};          ///< 未达到阈值时的最长处理间隔
+    AsyncLogOverflow overflow = AsyncLogOverflow::Drop;   ///< 队列满时的策略
+};
+
+/**
+ * @class BinaryLogBackend
+ * @brief 二进制日志的记录队列与后台解码线程
+ *
+ * @details
+ * - 调用线程：把定长记录推入 RingQueue（MPSC），只有一次 CAS 与一次按已用长度的拷贝
+ * - 后台线程：解码为文本，组装 LogData 后交给 Log 的写回调（Log::SetLogWriterFunc），
+ *   因此可与 AsyncLogSink 等现有后端组合使用
+ * - 未 Start() 时 BinaryLog 在调用线程上同步解码并输出
+ * - Stop() 等待在途记录入队并处理完队列中的全部记录
+ *
+ * @author BUG
+ * @date 2025-12-26
+ */
+class BinaryLogBackend {
+public:
+    using Queue = RingQueue<BinaryLogRecord, Producers::Multi, Consumers::Single>;
+
+    static BinaryLogBackend& Instance() {
+        static BinaryLogBackend backend;
+        return backend;
+    }
+
+    ~BinaryLogBackend() {
+        Stop();
+    }
+
+    /**
+     * @brief 启动后台线程；队列在首次启动时按 options 创建，重复调用无效
+     */
+    void Start(BinaryLogOptions options = {}) {
+        if (_running.load(std::memory_order_acquire)) return;
+        if (!_queue) {
+            _options = options;
+            if (_options.wakeThreshold == 0) _options.wakeThreshold = 1;
+            _queue.reset(new Queue(_options.queueCapacity));
+        }
+        _running.store(true, std::memory_order_seq_cst);
+        _worker = std::thread(&BinaryLogBackend::WorkerLoop, this);
+    }
+
+    /**
+     * @brief 停止后台线程并处理完全部剩余记录
+     */
+    void Stop() {
+        if (!_running.exchange(false)) return;
+
+        _parking.NotifyAll();
+        if (_worker.joinable()) _worker.join();
+
+        while (true) {
+            bool idle = _inFlight.load(std::memory_order_seq_cst) == 0;
+            while (Drain() > 0) {}
+            if (idle) break;
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief 提交一条记录
+     */
+    void Submit(const BinaryLogRecord& record) {
+        _inFlight.fetch_add(1, std::memory_order_seq_cst);
+        if (!_running.load(std::memory_order_seq_cst)) {
+            _inFlight.fetch_sub(1, std::memory_order_release);
+            Dispatch(record);
+            return;
+        }
+
+        RingQueueResult r;
+        while ((r = _queue->TryPush(record)) != RingQueueResult::Ok) {
+            if (r == RingQueueResult::Full) {
+                _parking.NotifyOne();
+                if (_options.overflow == AsyncLogOverflow::Drop) {
+                    _dropped.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                }
+                std::this_thread::yield();
+            } else {
+                CpuRelax();
+            }
+        }
+        _inFlight.fetch_sub(1, std::memory_order_release);
+
+        if (r == RingQueueResult::Ok && _queue->SizeApprox() >= _options.wakeThreshold) {
+            _parking.NotifyOne();
+        }
+    }
+
+    /**
+     * @brief 因队列已满而被丢弃的记录数（仅 AsyncLogOverflow::Drop）
+     */
+    size_t DroppedCount() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    BinaryLogBackend() = default;
+    BinaryLogBackend(const BinaryLogBackend&) = delete;
+    BinaryLogBackend& operator=(const BinaryLogBackend&) = delete;
+
+    static void Dispatch(const BinaryLogRecord& record) {
+        static thread_local std::string content;
+        content.clear();
+        BinaryLogDecoder::Decode(record, content);
+
+        LogData data;
+        data.type = record.type;
+        data.file = record.file;
+        data.line = record.line;
+        data.function = record.function;
+        data.time = record.time;
+        data.content = content;
+        Log::Dispatch(data);
+    }
+
+    size_t Drain() {
+        size_t count = 0;
+        while (count < _options.wakeThreshold && _queue->TryPop(_current) == RingQueueResult::Ok) {
+            Dispatch(_current);
+            ++count;
+        }
+        return count;
+    }
+
+    void WorkerLoop() {
+        while (true) {
+            Drain();
+
+            if (!_running.load(std::memory_order_acquire)) break;
+            if (_queue->SizeApprox() >= _options.wakeThreshold) continue;
+
+            auto key = _parking.PrepareWait();
+            if (_queue->SizeApprox() >= _options.wakeThreshold || !_running.load(std::memory_order_acquire)) {
+                _parking.CancelWait();
+                continue;
+            }
+            _parking.WaitFor(key, _options.flushInterval);
+        }
+    }
+
+    BinaryLogOptions _options;
+    std::unique_ptr<Queue> _queue;
+    BinaryLogRecord _current{};          ///< 后台线程的解码缓冲
+
+    std::atomic<bool> _running{false};
+    alignas(kCacheLineSize) std::atomic<size_t> _inFlight{0};
+    std::atomic<size_t> _dropped{0};
+    EventCount _parking;
+    std::thread _worker;
+};
+
+/**
+ * @class BinaryLog
+ * @brief LOGBI() 等宏创建的调用点对象
+ *
+ * @details
+ * operator<< 只把参数的原始值按类型标签写入栈上的定长记录：
+ * - 整数 / 浮点 / bool / char：定长拷贝
+ * - string-like：长度 + 字节
+ * - 可迭代容器、KV 容器：元素数 + 元素（元素需为上述标量类型）
+ * - 其他类型：在调用线程上借助 operator<<(std::ostream&) 转为字符串（慢路径）
+ *
+ * 析构时把记录提交给 BinaryLogBackend。
+ */
+class BinaryLog {
+public:
+    BinaryLog(LOG_TYPE type, const char* file, const char* function, int line) {
+        _record.type = type;
+        _record.line = line;
+        _record.file = file;
+        _record.function = function;
+        _record.time = LogClock::Now();
+        _record.size = 0;
+        _record.truncated = false;
+    }
+
+    BinaryLog(const BinaryLog&) = delete;
+    BinaryLog& operator=(const BinaryLog&) = delete;
+
+    ~BinaryLog() {
+        BinaryLogBackend::Instance().Submit(_record);
+    }
+
+    template <typename T>
+    BinaryLog& operator<<(const T& data) {
+        if (_record.truncated) return *this;
+
+        if constexpr (is_string_like_v<T> || !is_iterable<T>::value) {
+            EncodeScalar(data);
+        } else if constexpr (is_kv_container<T>::value) {
+            EncodeContainer(BINARY_LOG_TAG::MAP, data, [&](const auto& item) {
+                return EncodeScalar(item.first) && EncodeScalar(item.second);
+            });
+        } else {
+            EncodeContainer(BINARY_LOG_TAG::LIST, data, [&](const auto& item) {
+                return EncodeScalar(item);
+            });
+        }
+        return *this;
+    }
+
+private:
+    bool Reserve(size_t bytes) {
+        if (_record.size + bytes > sizeof(_record.payload)) {
+            _record.truncated = true;
+            return false;
+        }
+        return true;
+    }
+
+    template <typename T>
+    void Put(const T& value) {
+        std::memcpy(_record.payload + _record.size, &value, sizeof(T));
+        _record.size = static_cast<uint16_t>(_record.size + sizeof(T));
+    }
+
+    template <typename T>
+    bool PutTagged(BINARY_LOG_TAG tag, const T& value) {
+        if (!Reserve(1 + sizeof(T))) return false;
+        Put(static_cast<uint8_t>(tag));
+        Put(value);
+        return true;
+    }
+
+    bool PutString(std::string_view value) {
+        if (!Reserve(1 + sizeof(uint16_t) + value.size())) return false;
+        Put(static_cast<uint8_t>(BINARY_LOG_TAG::STRING));
+        Put(static_cast<uint16_t>(value.size()));
+        std::memcpy(_record.payload + _record.size, value.data(), value.size());
+        _record.size = static_cast<uint16_t>(_record.size + value.size());
+        return true;
+    }
+
+    template <typename T>
+    bool EncodeScalar(const T& data) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return PutTagged(BINARY_LOG_TAG::BOOL, static_cast<uint8_t>(data));
+        } else if constexpr (std::is_same_v<T, char> ||
+                             std::is_same_v<T, signed char> ||
+                             std::is_same_v<T, unsigned char>) {
+            return PutTagged(BINARY_LOG_TAG::CHAR, static_cast<char>(data));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return PutTagged(BINARY_LOG_TAG::DOUBLE, static_cast<double>(data));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            return PutTagged(BINARY_LOG_TAG::INT, static_cast<int64_t>(data));
+        } else if constexpr (std::is_integral_v<T>) {
+            return PutTagged(BINARY_LOG_TAG::UINT, static_cast<uint64_t>(data));
+        } else if constexpr (std::is_enum_v<T>) {
+            return EncodeScalar(static_cast<std::underlying_type_t<T>>(data));
+        } else if constexpr (is_string_like_v<T>) {
+            return PutString(std::string_view(data));
+        } else {
+            // 慢路径：按 Log 的方式借助 ostream 转为文本
+            static thread_local std::string text;
+            LogThreadBuffer& tls = LogThreadBuffer::Get();
+            std::string* prev = tls.streambuf.target;
+            text.clear();
+            tls.streambuf.target = &text;
+            tls.stream << data;
+            tls.stream.clear();
+            tls.streambuf.target = prev;
+            return PutString(text);
+        }
+    }
+
+    template <typename T, typename EncodeItem>
+    void EncodeContainer(BINARY_LOG_TAG tag, const T& container, EncodeItem&& encode) {
+        if (!Reserve(1 + sizeof(uint16_t))) return;
+        Put(static_cast<uint8_t>(tag));
+        size_t countOffset = _record.size;
+        Put(static_cast<uint16_t>(0));
+
+        uint16_t count = 0;
+        for (const auto& item : container) {
+            size_t before = _record.size;
+            if (!encode(item)) {
+                // 回退不完整的元素（例如只写入了键）
+                _record.size = static_cast<uint16_t>(before);
+                break;
+            }
+            ++count;
+        }
+        std::memcpy(_record.payload + countOffset, &count, sizeof(count));
+    }
+
+    BinaryLogRecord _record;
+};
@@ -6,7 +6,8 @@
 #include <string>
 #include <vector>
 #include <chrono>
-#include <iomanip>
+#include <ctime>
+#include <cstdint>
 #include <sstream>
 #include <iostream>
 #include <functional>
@@ -17,6 +18,11 @@
 #include <unordered_map>
 #include <string_view>
 #include <utility>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
 
 #ifdef JSON_CPP
 #include <jsoncpp/json/json.h>
@@ -30,33 +36,86 @@ enum class LOG_TYPE {
     DEBUG,
 };
 
+// 日志级别（数值越大越严重），用于 LOG_MIN_LEVEL 与运行时级别门限
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO  1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_OFF   4
+
+// 编译期最低级别：低于它的日志语句整体被编译器消除（参数不会被求值）
+// 例如 -DLOG_MIN_LEVEL=LOG_LEVEL_INFO 去掉所有 LOGD()
+#ifndef LOG_MIN_LEVEL
+    #define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+constexpr int LogLevelOf(LOG_TYPE type) {
+    switch (type) {
+        case LOG_TYPE::DEBUG: return LOG_LEVEL_DEBUG;
+        case LOG_TYPE::INFO:  return LOG_LEVEL_INFO;
+        case LOG_TYPE::WARN:  return LOG_LEVEL_WARN;
+        case LOG_TYPE::ERROR: return LOG_LEVEL_ERROR;
+    }
+    return LOG_LEVEL_OFF;
+}
+
+// 日志记录
+// file / function 指向 __FILE__ / __func__ 字面量；
+// content 指向线程局部格式化缓冲区，仅在写回调执行期间有效，需要保留时请自行拷贝
 typedef struct{
     LOG_TYPE type;
-    std::string file;
+    const char* file;
     int line;
-    std::string function;
-    std::tm local_time;
-    std::string content;
+    const char* function;
+    std::chrono::system_clock::time_point time; // 记录时刻，格式化时才转换为本地时间
+    std::string_view content;
 }LogData;
 
+// 时间戳精度
+enum class LOG_TIME_FORMAT {
+    SECONDS,      // 2025-12-26 10:00:00
+    MICROSECONDS, // 2025-12-26 10:00:00.123456
+};
+
 // 宏定义
 
+// 级别未开启时整条语句（包括 Log 构造、取时间与所有 operator<< 参数）都不执行：
+// - 低于 LOG_MIN_LEVEL：条件为编译期常量 false，语句被消除
+// - 低于运行时级别：只有一次 relaxed load
+// 展开为单个表达式，可安全用于不带花括号的 if / else
+#define LOG_STATEMENT_(type) \
+    !Log::IsEnabled(type) ? (void)0 : LogVoidify() & Log(type, __FILE__, __func__, __LINE__)
+
 #ifndef LOGI
-    #define LOGI() Log(LOG_TYPE::INFO, __FILE__, __func__, __LINE__)
+    #define LOGI() LOG_STATEMENT_(LOG_TYPE::INFO)
 #endif
 
 #ifndef LOGE
-    #define LOGE() Log(LOG_TYPE::ERROR, __FILE__, __func__, __LINE__)
+    #define LOGE() LOG_STATEMENT_(LOG_TYPE::ERROR)
 #endif
 
 #ifndef LOGW
-    #define LOGW() Log(LOG_TYPE::WARN, __FILE__, __func__, __LINE__)
+    #define LOGW() LOG_STATEMENT_(LOG_TYPE::WARN)
 #endif
 
 #ifndef LOGD
-    #define LOGD() Log(LOG_TYPE::DEBUG, __FILE__, __func__, __LINE__)
+    #define LOGD() LOG_STATEMENT_(LOG_TYPE::DEBUG)
 #endif
 
+// 调用点采样：每个宏展开处的 lambda 各自拥有一份静态状态（常量初始化，无守卫开销）
+// 被采样丢弃的语句与级别关闭时相同，不构造 Log、不求值参数
+#define LOG_CALL_SITE_(Sampler) ([]() -> Sampler& { static Sampler sampler; return sampler; }())
+
+// 每 n 次只输出第 1 次
+#define LOG_EVERY_N(type, n) \
+    !(Log::IsEnabled(type) && LOG_CALL_SITE_(LogEveryN).Allow(n)) ? (void)0 \
+        : LogVoidify() & Log(type, __FILE__, __func__, __LINE__)
+
+// 每秒最多输出 k 次
+#define LOG_PER_SECOND(type, k) \
+    !(Log::IsEnabled(type) && LOG_CALL_SITE_(LogRateLimit).Allow(k)) ? (void)0 \
+        : LogVoidify() & Log(type, __FILE__, __func__, __LINE__)
+
 // 是否可迭代（有 begin/end 的类型）
 template <typename T>
 class is_iterable {
@@ -99,48 +158,219 @@ template <typename T>
 constexpr bool is_string_like_v = std::is_convertible_v<T, std::string_view>;
 
 
+// ------------------ Log buffer ------------------
+
+// 把 std::ostream 的输出直接追加到 std::string，供没有快速路径的类型使用
+class LogStreamBuf : public std::streambuf {
+public:
+    std::string* target = nullptr;
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (ch != traits_type::eof())
+            target->push_back(static_cast<char>(ch));
+        return ch;
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        target->append(s, static_cast<size_t>(n));
+        return n;
+    }
+};
+
+// 每个线程一份：格式化缓冲区、整行缓冲区与回退用的 ostream，容量跨日志复用
+struct LogThreadBuffer {
+    std::string content;
+    std::string line;
+    bool in_use = false;
+    LogStreamBuf streambuf;
+    std::ostream stream{&streambuf};
+
+    static LogThreadBuffer& Get() {
+        static thread_local LogThreadBuffer buffer;
+        return buffer;
+    }
+};
+
+// ------------------ Timestamp ------------------
+
+// 记录时刻的时钟
+// 定义 LOG_CLOCK_COARSE 时在 Linux 上使用 CLOCK_REALTIME_COARSE（精度为一个 tick，读取开销更低）
+struct LogClock {
+    static std::chrono::system_clock::time_point Now() {
+#if defined(LOG_CLOCK_COARSE) && defined(__linux__)
+        timespec ts;
+        clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec)));
+#else
+        return std::chrono::system_clock::now();
+#endif
+    }
+};
+
+// 每线程缓存 "YYYY-mm-dd HH:MM:SS" 前缀，只有秒数变化时才调用 localtime_r / strftime
+class LogTimestampCache {
+public:
+    static void Append(std::string& out, std::chrono::system_clock::time_point time, LOG_TIME_FORMAT format) {
+        static thread_local LogTimestampCache cache;
+
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+        int64_t second = us / 1000000;
+        int64_t micros = us % 1000000;
+        if (micros < 0) {
+            micros += 1000000;
+            --second;
+        }
+
+        if (second != cache._second) {
+            cache.Render(second);
+        }
+        out.append(cache._prefix, cache._length);
+
+        if (format == LOG_TIME_FORMAT::MICROSECONDS) {
+            char digits[7];
+            digits[0] = '.';
+            for (int i = 6; i >= 1; --i) {
+                digits[i] = static_cast<char>('0' + micros % 10);
+                micros /= 10;
+            }
+            out.append(digits, sizeof(digits));
+        }
+    }
+
+private:
+    void Render(int64_t second) {
+        std::time_t t = static_cast<std::time_t>(second);
+        std::tm local_time{};
+#if defined(_WIN32)
+        localtime_s(&local_time, &t);
+#else
+        localtime_r(&t, &local_time);
+#endif
+        _length = std::strftime(_prefix, sizeof(_prefix), "%Y-%m-%d %H:%M:%S", &local_time);
+        _second = second;
+    }
+
+    int64_t _second = INT64_MIN;
+    char _prefix[32] = {};
+    size_t _length = 0;
+};
+
+// ------------------ Sampling ------------------
+
+// "每 n 次输出一次" 的调用点状态
+class LogEveryN {
+public:
+    constexpr LogEveryN() = default;
+
+    bool Allow(uint64_t n) {
+        if (n <= 1) return true;
+        return _count.fetch_add(1, std::memory_order_relaxed) % n == 0;
+    }
+
+private:
+    std::atomic<uint64_t> _count{0};
+};
+
+// "每秒最多 k 次" 的调用点状态：按秒划分窗口，窗口内计数超过 k 即丢弃
+// 窗口切换时的竞争至多让边界处多放行几条，不影响上限的量级
+class LogRateLimit {
+public:
+    constexpr LogRateLimit() = default;
+
+    bool Allow(uint32_t k) {
+        int64_t second = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t window = _window.load(std::memory_order_relaxed);
+        if (window != second &&
+            _window.compare_exchange_strong(window, second, std::memory_order_relaxed)) {
+            _count.store(0, std::memory_order_relaxed);
+        }
+        return _count.fetch_add(1, std::memory_order_relaxed) < k;
+    }
+
+private:
+    std::atomic<int64_t> _window{INT64_MIN};
+    std::atomic<uint32_t> _count{0};
+};
+
 // ------------------ Log class ------------------
 
+class Log;
+
+// 日志去向：dispatch 为空时走全局写回调，否则交给 context（例如 Logger）
+// 用函数指针而非 std::function，构造与派发都不产生分配
+struct LogRoute {
+    void* context = nullptr;
+    void (*dispatch)(void* context, const LogData& data) = nullptr;
+};
+
+using LogWriterFunc = std::function<void(const LogData&)>;
+
+// 把 Log（或 BinaryLog）表达式转换为 void，使 LOG_STATEMENT_ 的两个分支类型一致
+// operator& 优先级低于 operator<<，因此整条 << 链先完成
+struct LogVoidify {
+    template <typename Record>
+    void operator&(const Record&) const {}
+};
+
 class Log {
 public:
-    Log(LOG_TYPE type, const std::string& file, const char* function, int line){
-        // 获取当前时间
-        auto now = std::chrono::system_clock::now();
-        // 转换为时间戳
-        auto now_c = std::chrono::system_clock::to_time_t(now);
-        // 转换为本地时间
-        std::tm* local_time = std::localtime(&now_c);
-        _local_time = *local_time;
-        _type = type;
-        _file = file;
-        _line = line;
-        _log_function = function;
-    }
-
-    static std::string ToString(LogData LogData) {
-        std::ostringstream content;
-        content << std::put_time(&LogData.local_time, "%Y-%m-%d %H:%M:%S");
-        content << " ";
+    Log(LOG_TYPE type, const char* file, const char* function, int line, LogRoute route = {})
+        : _type(type), _file(file), _line(line), _log_function(function), _route(route)
+    {
+        // 只记录时刻；本地时间的转换推迟到格式化（异步后端中即写线程）
+        _time = LogClock::Now();
+
+        // 优先使用线程局部缓冲区；嵌套日志（在 operator<< 或回调中再次打日志）使用自有缓冲区
+        LogThreadBuffer& tls = LogThreadBuffer::Get();
+        if (!tls.in_use) {
+            tls.in_use = true;
+            _content = &tls.content;
+        } else {
+            _content = &_own_content;
+        }
+    }
+
+    Log(const Log&) = delete;
+    Log& operator=(const Log&) = delete;
+
+    // 将日志格式化为一整行（不含换行），追加到 out
+    static void Format(const LogData& LogData, std::string& out) {
+        LogTimestampCache::Append(out, LogData.time, _time_format.load(std::memory_order_relaxed));
+        out.push_back(' ');
         switch(LogData.type){
-            case LOG_TYPE::INFO:  content << " I "; break;
-            case LOG_TYPE::WARN:  content << " W "; break;
-            case LOG_TYPE::ERROR: content << " E "; break;
-            case LOG_TYPE::DEBUG: content << " D "; break;
+            case LOG_TYPE::INFO:  out.append(" I "); break;
+            case LOG_TYPE::WARN:  out.append(" W "); break;
+            case LOG_TYPE::ERROR: out.append(" E "); break;
+            case LOG_TYPE::DEBUG: out.append(" D "); break;
         }
-        content << LogData.file;
-        content << "[" << LogData.line << "][" << LogData.function << "] ";
-        return content.str() + LogData.content;
+        out.append(LogData.file);
+        out.push_back('[');
+        AppendNumber(out, LogData.line);
+        out.append("][");
+        out.append(LogData.function);
+        out.append("] ");
+        out.append(LogData.content);
+    }
+
+    static std::string ToString(const LogData& LogData) {
+        std::string content;
+        Format(LogData, content);
+        return content;
     }
     
     // 普通单值输出（保留）
     template <typename T>
     std::enable_if_t<
         !is_iterable<T>::value || 
-        std::is_same_v<T, std::string> ||
-        std::is_same_v<T, std::string_view>,
+        is_string_like_v<T>,
     Log&>
     operator<<(const T& data){
-        _content << data << " ";
+        Append(data);
+        _content->push_back(' ');
         return *this;
     }
 
@@ -155,14 +385,14 @@ public:
     Log&>
     operator<<(const T& container)
     {
-        _content << "{";
+        _content->push_back('{');
         bool first = true;
         for (const auto& item : container) {
-            if (!first) _content << ", ";
-                _content << item;
+            if (!first) _content->append(", ");
+                Append(item);
             first = false;
         }
-        _content << "} ";
+        _content->append("} ");
         return *this;
     }
 
@@ -173,14 +403,18 @@ public:
     std::enable_if_t<is_kv_container<T>::value, Log&>
     operator<<(const T& container)
     {
-        _content << "MAP:{";
+        _content->append("MAP:{");
         bool first = true;
         for (const auto& item : container) {
-            if (!first) _content << ", ";
-            _content << "[" << item.first << "," << item.second << "]";
+            if (!first) _content->append(", ");
+            _content->push_back('[');
+            Append(item.first);
+            _content->push_back(',');
+            Append(item.second);
+            _content->push_back(']');
             first = false;
         }
-        _content << "} ";
+        _content->append("} ");
         return *this;
     }
 
@@ -190,43 +424,149 @@ public:
         writer_builder["indentation"] = "";
         writer_builder["enableYAMLCompatibility"] = true;
         writer_builder["emitUTF8"] = true;
-        std::ostringstream oss;
         std::unique_ptr<Json::StreamWriter> writer(writer_builder.newStreamWriter());
-        writer->write(json, &oss);
-        _content << oss.str();
+        WithStream([&](std::ostream& os) { writer->write(json, &os); });
         return *this;
     }
 #endif
 
     ~Log() {
-        if (_log_writer_func)
-            _log_writer_func(ToLogInfo());
-        else
-            std::cout << ToString(ToLogInfo()) << std::endl;
+        if (_route.dispatch) {
+            _route.dispatch(_route.context, ToLogInfo());
+        } else {
+            Dispatch(ToLogInfo());
+        }
+
+        if (_content != &_own_content) {
+            _content->clear();
+            LogThreadBuffer::Get().in_use = false;
+        }
+    }
+
+
+    // 交给写回调；未设置回调时输出到 std::cout
+    static void Dispatch(const LogData& data) {
+        if (const LogWriterFunc* writer = _log_writer_func.load(std::memory_order_acquire)) {
+            (*writer)(data);
+        } else {
+            WriteStdout(data);
+        }
+    }
+
+    // 按 Log 的文本格式写到 std::cout（以 '\n' 结尾）
+    static void WriteStdout(const LogData& data) {
+        std::string& line = LogThreadBuffer::Get().line;
+        line.clear();
+        Format(data, line);
+        line.push_back('\n');
+        std::cout.write(line.data(), static_cast<std::streamsize>(line.size()));
+    }
+
+    // 以 Log 的文本格式输出数值（整数为十进制，浮点与 ostream 默认格式一致）
+    template <typename T>
+    static void AppendNumber(std::string& out, T value) {
+        char buf[64];
+        std::to_chars_result r;
+        if constexpr (std::is_floating_point_v<T>) {
+            // 与 ostream 默认格式一致（%g，6 位有效数字）
+            r = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::general, 6);
+        } else {
+            r = std::to_chars(buf, buf + sizeof(buf), value);
+        }
+        out.append(buf, static_cast<size_t>(r.ptr - buf));
+    }
+
+    // 编译期门限 + 运行时门限
+    static inline bool IsEnabled(LOG_TYPE type) {
+        return LogLevelOf(type) >= LOG_MIN_LEVEL &&
+               LogLevelOf(type) >= _min_level.load(std::memory_order_relaxed);
+    }
+
+    // 设置运行时最低级别（LOG_LEVEL_*），不能低于 LOG_MIN_LEVEL
+    static inline void SetLogLevel(int level) {
+        _min_level.store(level, std::memory_order_relaxed);
     }
 
+    static inline void SetLogLevel(LOG_TYPE type) {
+        SetLogLevel(LogLevelOf(type));
+    }
+
+    static inline int GetLogLevel() {
+        return _min_level.load(std::memory_order_relaxed);
+    }
+
+    // 设置格式化时的时间戳精度
+    static inline void SetTimeFormat(LOG_TIME_FORMAT format) {
+        _time_format.store(format, std::memory_order_relaxed);
+    }
+
+    // 替换全局写回调，可与正在打日志的线程并发调用
+    // 新回调发布为不可变对象，旧回调不会被释放（正在执行它的线程仍可安全使用），直到进程退出
+    static inline void SetLogWriterFunc(LogWriterFunc func){
+        std::lock_guard<std::mutex> lock(_writer_mutex);
+        const LogWriterFunc* next = func ? &_writer_history.emplace_back(std::move(func)) : nullptr;
+        _log_writer_func.store(next, std::memory_order_release);
+    }
 
-    static inline void SetLogWriterFunc(std::function<void(LogData)> func){
-        _log_writer_func = func;
+    // 当前的全局写回调（拷贝），未设置时为空
+    static inline LogWriterFunc GetLogWriterFunc() {
+        std::lock_guard<std::mutex> lock(_writer_mutex);
+        const LogWriterFunc* current = _log_writer_func.load(std::memory_order_acquire);
+        return current ? *current : LogWriterFunc{};
     }
 
-    LogData ToLogInfo() {
+    // 仅做指针 / 视图赋值，不拷贝字符串
+    LogData ToLogInfo() const {
         LogData LogData;
         LogData.type = _type;
         LogData.file = _file;
         LogData.line = _line;
         LogData.function = _log_function;
-        LogData.local_time = _local_time;
-        LogData.content = _content.str();
+        LogData.time = _time;
+        LogData.content = *_content;
         return LogData;
     }
 
 private:
+    // 借用线程局部 ostream 输出到当前缓冲区（支持嵌套日志）
+    template <typename F>
+    void WithStream(F&& write) {
+        LogThreadBuffer& tls = LogThreadBuffer::Get();
+        std::string* prev = tls.streambuf.target;
+        tls.streambuf.target = _content;
+        write(tls.stream);
+        tls.stream.clear();
+        tls.streambuf.target = prev;
+    }
+
+    template <typename T>
+    void Append(const T& data) {
+        if constexpr (std::is_same_v<T, bool>) {
+            _content->push_back(data ? '1' : '0');
+        } else if constexpr (std::is_same_v<T, char> ||
+                             std::is_same_v<T, signed char> ||
+                             std::is_same_v<T, unsigned char>) {
+            _content->push_back(static_cast<char>(data));
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            AppendNumber(*_content, data);
+        } else if constexpr (is_string_like_v<T>) {
+            _content->append(std::string_view(data));
+        } else {
+            WithStream([&](std::ostream& os) { os << data; });
+        }
+    }
+
     LOG_TYPE _type;
-    std::string _file;
+    const char* _file;
     int _line;
-    std::string _log_function;
-    std::tm _local_time;
-    std::ostringstream _content;
-    static inline std::function<void(const LogData)> _log_writer_func = nullptr;
+    const char* _log_function;
+    std::chrono::system_clock::time_point _time;
+    std::string* _content;      ///< 当前使用的格式化缓冲区
+    std::string _own_content;   ///< 嵌套日志时使用的缓冲区
+    LogRoute _route;
+    static inline std::atomic<const LogWriterFunc*> _log_writer_func{nullptr};
+    static inline std::mutex _writer_mutex;
+    static inline std::list<LogWriterFunc> _writer_history; ///< 发布过的回调（list 保证地址稳定）
+    static inline std::atomic<int> _min_level{LOG_MIN_LEVEL};
+    static inline std::atomic<LOG_TIME_FORMAT> _time_format{LOG_TIME_FORMAT::SECONDS};
 };
@@ -0,0 +1,458 @@
+#pragma once
+
+#include <map>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <Log/Log.hpp>
+#include <Consumer/ThreadConsumer.hpp>
+
+// 派发模式
+enum class LOG_DISPATCH_MODE {
+    SYNC,          ///< 在打日志的线程上直接调用 sink
+    GLOBAL_THREAD, ///< 拷贝正文推入有界队列，由一个全局派发线程调用 sink
+};
+
+// 写往命名 Logger 的日志语句，logger 为 Logger*
+#define LOG_TO(logger, type) \
+    !(logger)->IsEnabled(type) ? (void)0 \
+        : LogVoidify() & Log(type, __FILE__, __func__, __LINE__, (logger)->Route())
+
+#define LOG_TO_EVERY_N(logger, type, n) \
+    !((logger)->IsEnabled(type) && LOG_CALL_SITE_(LogEveryN).Allow(n)) ? (void)0 \
+        : LogVoidify() & Log(type, __FILE__, __func__, __LINE__, (logger)->Route())
+
+#define LOG_TO_PER_SECOND(logger, type, k) \
+    !((logger)->IsEnabled(type) && LOG_CALL_SITE_(LogRateLimit).Allow(k)) ? (void)0 \
+        : LogVoidify() & Log(type, __FILE__, __func__, __LINE__, (logger)->Route())
+
+#define LOGI_TO(logger) LOG_TO(logger, LOG_TYPE::INFO)
+#define LOGW_TO(logger) LOG_TO(logger, LOG_TYPE::WARN)
+#define LOGE_TO(logger) LOG_TO(logger, LOG_TYPE::ERROR)
+#define LOGD_TO(logger) LOG_TO(logger, LOG_TYPE::DEBUG)
+
+/**
+ * @class LogSinkList
+ * @brief 可与写入并发替换的 sink 列表
+ *
+ * @details
+ * 每次修改都发布一份新的不可变 vector，读者只做一次 acquire load 并遍历，
+ * 不加锁、不拷贝 std::function。旧列表保留到本对象析构，
+ * 正在遍历它的线程因此不会访问已释放的内存；修改频率很低（配置期），保留的代价可以忽略。
+ *
+ * @author BUG
+ * @date 2025-12-27
+ */
+class LogSinkList {
+public:
+    using Sink = LogWriterFunc;
+
+    LogSinkList() = default;
+    LogSinkList(const LogSinkList&) = delete;
+    LogSinkList& operator=(const LogSinkList&) = delete;
+
+    /**
+     * @brief 追加一个 sink
+     */
+    void Add(Sink sink) {
+        if (!sink) return;
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<Sink> next;
+        if (const auto* current = _current.load(std::memory_order_relaxed)) next = *current;
+        next.push_back(std::move(sink));
+        Publish(std::move(next));
+    }
+
+    /**
+     * @brief 只保留给定的 sink（为空时等价于 Clear）
+     */
+    void Set(Sink sink) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<Sink> next;
+        if (sink) next.push_back(std::move(sink));
+        Publish(std::move(next));
+    }
+
+    /**
+     * @brief 移除全部 sink
+     */
+    void Clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _current.store(nullptr, std::memory_order_release);
+    }
+
+    /**
+     * @brief 依次交给每个 sink
+     * @return false 表示没有任何 sink
+     */
+    bool Write(const LogData& data) const {
+        const auto* sinks = _current.load(std::memory_order_acquire);
+        if (!sinks) return false;
+        for (const auto& sink : *sinks) sink(data);
+        return true;
+    }
+
+private:
+    void Publish(std::vector<Sink>&& next) {
+        if (next.empty()) {
+            _current.store(nullptr, std::memory_order_release);
+            return;
+        }
+        _current.store(&_history.emplace_back(std::move(next)), std::memory_order_release);
+    }
+
+    std::atomic<const std::vector<Sink>*> _current{nullptr};
+    std::mutex _mutex;
+    std::list<std::vector<Sink>> _history; ///< 发布过的列表（list 保证地址稳定）
+};
+
+class LoggerManager;
+
+/**
+ * @class Logger
+ * @brief 命名 Logger：独立的级别、sink 列表与每秒条数上限
+ *
+ * @details
+ * - 级别：编译期 LOG_MIN_LEVEL 与本 Logger 的运行时级别，
+ *   关闭时 LOG_TO 语句不构造 Log、不求值参数
+ * - sink：未设置时使用 LoggerManager::SetWriteCallback 的回调，仍为空则输出到 std::cout；
+ *   默认 Logger 在这两者之前先使用 Start 前已设置的 Log::SetLogWriterFunc 回调
+ * - 限流：SetMaxPerSecond(k) 后本 Logger 每秒最多写出 k 条，多余的计入 DroppedCount；
+ *   GLOBAL_THREAD 模式下队列已满同样丢弃并计数，刷屏的代码路径不会拖住派发线程或磁盘
+ *
+ * Logger 由 LoggerManager 创建，地址在进程内保持不变。
+ *
+ * @author BUG
+ * @date 2025-12-27
+ */
+class Logger {
+public:
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    const std::string& Name() const {
+        return _name;
+    }
+
+    /**
+     * @brief 编译期门限 + 本 Logger 的运行时门限
+     */
+    bool IsEnabled(LOG_TYPE type) const {
+        return LogLevelOf(type) >= LOG_MIN_LEVEL &&
+               LogLevelOf(type) >= _min_level.load(std::memory_order_relaxed);
+    }
+
+    void SetLogLevel(int level) {
+        _min_level.store(level, std::memory_order_relaxed);
+    }
+
+    void SetLogLevel(LOG_TYPE type) {
+        SetLogLevel(LogLevelOf(type));
+    }
+
+    int GetLogLevel() const {
+        return _min_level.load(std::memory_order_relaxed);
+    }
+
+    void AddSink(LogSinkList::Sink sink) {
+        _sinks.Add(std::move(sink));
+    }
+
+    void SetSink(LogSinkList::Sink sink) {
+        _sinks.Set(std::move(sink));
+    }
+
+    void ClearSinks() {
+        _sinks.Clear();
+    }
+
+    /**
+     * @brief 每秒最多写出的条数，0 表示不限
+     */
+    void SetMaxPerSecond(uint32_t limit) {
+        _max_per_second.store(limit, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 因限流或派发队列已满而丢弃的条数
+     */
+    size_t DroppedCount() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 供 Log 构造使用的去向
+     */
+    LogRoute Route() {
+        return LogRoute{this, &Logger::DispatchThunk};
+    }
+
+    /**
+     * @brief 按 LoggerManager 的派发模式写出一条日志
+     */
+    inline void Write(const LogData& data);
+
+private:
+    friend class LoggerManager;
+
+    Logger(LoggerManager& manager, std::string name)
+        : _manager(manager), _name(std::move(name))
+    {}
+
+    static void DispatchThunk(void* context, const LogData& data) {
+        static_cast<Logger*>(context)->Write(data);
+    }
+
+    /**
+     * @brief 调用 sink（在当前线程）
+     */
+    inline void Deliver(const LogData& data) const;
+
+    LoggerManager& _manager;
+    std::string _name;
+    std::atomic<int> _min_level{LOG_MIN_LEVEL};
+    std::atomic<uint32_t> _max_per_second{0};
+    LogRateLimit _rate;
+    std::atomic<size_t> _dropped{0};
+    LogSinkList _sinks;
+};
+
+/**
+ * @class LoggerManager
+ * @brief 命名 Logger 的注册表与全局派发线程
+ *
+ * @details
+ * - InsertLogger / GetLogger 按名称创建与查找 Logger；Logger 不会被移除，指针可长期持有
+ * - SetWriteCallback 设置没有自有 sink 的 Logger 使用的回调
+ * - Start(GLOBAL_THREAD)：写入只拷贝正文推入有界 RingQueue（MPSC），
+ *   由一个派发线程调用 sink；队列满时丢弃并计入对应 Logger 的 DroppedCount
+ * - Start 同时把 LOGI() 等全局宏接入默认 Logger（GetDefaultLogger()）；此前通过
+ *   Log::SetLogWriterFunc 设置的回调（如 AsyncLogSink）被保存下来，作为默认 Logger 的 sink，
+ *   Stop 时恢复为全局写回调
+ * - Stop 写出队列中剩余的全部日志，之后回到 SYNC 模式
+ *
+ * @code
+ *   auto& mgr = LoggerManager::GetLoggerManager();
+ *   Logger* net = mgr.InsertLogger("Network");
+ *   net->SetLogLevel(LOG_TYPE::WARN);
+ *   mgr.SetWriteCallback([](const LogData& d) { ... });
+ *   mgr.Start(LOG_DISPATCH_MODE::GLOBAL_THREAD);
+ *   LOGW_TO(net) << "slow";
+ *   LOG_TO_PER_SECOND(net, LOG_TYPE::ERROR, 10) << "retry";
+ *   mgr.Stop();
+ * @endcode
+ *
+ * @author BUG
+ * @date 2025-12-27
+ */
+class LoggerManager {
+public:
+    static LoggerManager& GetLoggerManager() {
+        static LoggerManager manager;
+        return manager;
+    }
+
+    LoggerManager(const LoggerManager&) = delete;
+    LoggerManager& operator=(const LoggerManager&) = delete;
+
+    ~LoggerManager() {
+        Stop();
+    }
+
+    /**
+     * @brief 创建命名 Logger，已存在时返回已有的
+     */
+    Logger* InsertLogger(const std::string& name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _loggers.find(name);
+        if (it == _loggers.end()) {
+            it = _loggers.emplace(name, std::unique_ptr<Logger>(new Logger(*this, name))).first;
+        }
+        return it->second.get();
+    }
+
+    /**
+     * @brief 查找命名 Logger
+     * @return 不存在时返回 nullptr
+     */
+    Logger* GetLogger(const std::string& name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _loggers.find(name);
+        return it == _loggers.end() ? nullptr : it->second.get();
+    }
+
+    /**
+     * @brief 全局宏 LOGI() 等在 Start 后写入的 Logger
+     */
+    Logger* GetDefaultLogger() {
+        return &_default;
+    }
+
+    /**
+     * @brief 设置没有自有 sink 的 Logger 使用的回调，可与写入并发调用
+     */
+    void SetWriteCallback(LogSinkList::Sink callback) {
+        _callback.Set(std::move(callback));
+    }
+
+    /**
+     * @brief 设置派发模式并接管全局宏
+     *
+     * @param mode 派发模式
+     * @param queueCapacity GLOBAL_THREAD 模式的队列容量
+     * @thread_safety 非线程安全，应在初始化阶段调用
+     */
+    void Start(LOG_DISPATCH_MODE mode = LOG_DISPATCH_MODE::SYNC, size_t queueCapacity = 8192) {
+        std::lock_guard<std::mutex> lock(_control_mutex);
+        if (mode == LOG_DISPATCH_MODE::GLOBAL_THREAD) {
+            if (!_dispatcher) {
+                _dispatcher = std::make_unique<Dispatcher>(
+                    [](Record record) { record.Deliver(); }, 1, queueCapacity);
+            }
+            _dispatcher->Start();
+        }
+        _mode.store(mode, std::memory_order_release);
+
+        if (_captured) return;
+        _previous = Log::GetLogWriterFunc();
+        _inherited.Set(_previous);
+        Logger* fallback = &_default;
+        Log::SetLogWriterFunc([fallback](const LogData& data) { fallback->Write(data); });
+        _captured = true;
+    }
+
+    /**
+     * @brief 写出剩余日志，回到 SYNC 模式并解除对全局宏的接管（恢复 Start 前的全局写回调）
+     */
+    void Stop() {
+        std::lock_guard<std::mutex> lock(_control_mutex);
+        _mode.store(LOG_DISPATCH_MODE::SYNC, std::memory_order_release);
+        if (_dispatcher) _dispatcher->Stop(true);
+        if (_captured) {
+            Log::SetLogWriterFunc(std::move(_previous));
+            _previous = nullptr;
+            _inherited.Clear();
+            _captured = false;
+        }
+    }
+
+    LOG_DISPATCH_MODE Mode() const {
+        return _mode.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class Logger;
+
+    /// Record 内联正文的容量，更长的正文才会分配堆内存
+    static constexpr size_t kInlineText = 192;
+
+    /**
+     * @brief 派发队列元素
+     *
+     * @details
+     * - 不超过 kInlineText 的正文拷贝到内联缓冲 text，更长的存放在 spill 中
+     * - 移动只拷贝内联缓冲中已使用的 size 字节
+     * - meta.content 在派发线程上重新指向正文
+     */
+    struct Record {
+        Logger* logger = nullptr;
+        LogData meta{};
+        std::string spill;
+        uint32_t size = 0;
+        char text[kInlineText];
+
+        Record() = default;
+
+        Record(Logger& owner, const LogData& data)
+            : logger(&owner), meta(data)
+        {
+            meta.content = {};
+            if (data.content.size() <= kInlineText) {
+                size = static_cast<uint32_t>(data.content.size());
+                std::memcpy(text, data.content.data(), size);
+            } else {
+                spill.assign(data.content);
+            }
+        }
+
+        Record(Record&& other) noexcept
+            : logger(other.logger), meta(other.meta), spill(std::move(other.spill)), size(other.size)
+        {
+            std::memcpy(text, other.text, size);
+        }
+
+        Record& operator=(Record&& other) noexcept {
+            logger = other.logger;
+            meta = other.meta;
+            spill = std::move(other.spill);
+            size = other.size;
+            std::memcpy(text, other.text, size);
+            return *this;
+        }
+
+        std::string_view Text() const {
+            return size > 0 ? std::string_view(text, size) : std::string_view(spill);
+        }
+
+        void Deliver() {
+            meta.content = Text();
+            logger->Deliver(meta);
+        }
+    };
+
+    using Dispatcher = ThreadConsumer<Record, RingQueueStorage<Producers::Multi, Consumers::Single>>;
+
+    LoggerManager()
+        : _default(*this, "")
+    {}
+
+    /**
+     * @brief 异步派发
+     * @return false 表示当前不是 GLOBAL_THREAD 模式（或正在停止），调用者应同步写出
+     */
+    bool Enqueue(Logger& logger, const LogData& data) {
+        if (_mode.load(std::memory_order_acquire) != LOG_DISPATCH_MODE::GLOBAL_THREAD) return false;
+
+        if (_dispatcher->TryAddTask(Record(logger, data))) return true;
+
+        // 未入队：派发器已停止则回退为同步写，否则为队列已满
+        if (_mode.load(std::memory_order_acquire) != LOG_DISPATCH_MODE::GLOBAL_THREAD) return false;
+        logger._dropped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::atomic<LOG_DISPATCH_MODE> _mode{LOG_DISPATCH_MODE::SYNC};
+    std::mutex _mutex;                                      ///< 保护 _loggers
+    std::mutex _control_mutex;                              ///< 串行化 Start / Stop
+    std::map<std::string, std::unique_ptr<Logger>> _loggers;
+    Logger _default;
+    LogSinkList _callback;
+    LogSinkList _inherited;                                 ///< Start 前的全局写回调，默认 Logger 使用
+    LogWriterFunc _previous;                                ///< Stop 时恢复的全局写回调
+    std::unique_ptr<Dispatcher> _dispatcher;
+    bool _captured = false;
+};
+
+inline void Logger::Write(const LogData& data) {
+    uint32_t limit = _max_per_second.load(std::memory_order_relaxed);
+    if (limit != 0 && !_rate.Allow(limit)) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (_manager.Enqueue(*this, data)) return;
+    Deliver(data);
+}
+
+inline void Logger::Deliver(const LogData& data) const {
+    if (_sinks.Write(data)) return;
+    if (this == &_manager._default && _manager._inherited.Write(data)) return;
+    if (_manager._callback.Write(data)) return;
+    Log::WriteStdout(data);
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <Log/AsyncLogSink.hpp>
+
+// mmap 滚动文件后端配置
+struct MmapLogSinkOptions {
+    std::string basePath = "app";                         ///< 文件名前缀，段文件为 <basePath>.<YYYYmmdd-HHMMSS>.<pid>.<序号>.log
+    size_t segmentSize = 64u << 20;                       ///< 每段预分配大小，写满即滚动
+    std::chrono::seconds rollInterval{3600};              ///< 按时间滚动的间隔，0 表示只按大小滚动
+    size_t syncBytes = 8u << 20;                          ///< 累计多少脏字节后发起一次后台回写
+    AsyncLogSinkOptions async{};                          ///< 前台队列 / 批次 / 空闲间隔
+};
+
+/**
+ * @class MmapLogOutput
+ * @brief BasicAsyncLogSink 的输出端：写入 mmap 映射的预分配段文件
+ *
+ * @details
+ * - 每段文件以 posix_fallocate 预分配 segmentSize 字节并以 MAP_SHARED 映射，
+ *   写线程把格式化好的行直接 memcpy 进映射区，每批不产生 write() 系统调用
+ * - 脏数据累计到 syncBytes、或写线程空闲醒来时，对已写区间发起 msync(MS_ASYNC)，
+ *   并对已回写的整页 madvise(MADV_DONTNEED)，常驻内存只保留最近写入的部分
+ * - 段写满或超过 rollInterval 时滚动：msync、munmap，
+ *   再 ftruncate 到实际写入长度去掉预分配的尾部
+ * - 单行超过 segmentSize 时为其单独开一段足够大的文件
+ * - 段文件名带 pid，并以 O_EXCL 创建：同名文件已存在（多进程共享 basePath、pid 复用）时递增序号，
+ *   从不截断已有的日志
+ * - 打开 / 预分配 / 映射失败时不在每次 Append 上重试：重试间隔从 100ms 起翻倍、最长 10s，
+ *   期间写入的数据被丢弃并计入 DroppedBytes()
+ *
+ * 进程崩溃时当前段可能以一段 '\0' 结尾（预分配区域），已写入映射区的内容由内核负责落盘。
+ *
+ * @author BUG
+ * @date 2025-12-27
+ */
+class MmapLogOutput {
+public:
+    explicit MmapLogOutput(const MmapLogSinkOptions& options)
+        : _basePath(options.basePath)
+        , _segmentSize(options.segmentSize == 0 ? 1 : options.segmentSize)
+        , _rollInterval(options.rollInterval)
+        , _syncBytes(options.syncBytes)
+        , _pageSize(static_cast<size_t>(::sysconf(_SC_PAGESIZE)))
+    {
+        OpenSegment(_segmentSize);
+    }
+
+    ~MmapLogOutput() {
+        CloseSegment();
+    }
+
+    MmapLogOutput(const MmapLogOutput&) = delete;
+    MmapLogOutput& operator=(const MmapLogOutput&) = delete;
+
+    bool IsOpen() const {
+        return _base != nullptr;
+    }
+
+    /**
+     * @brief 当前段文件路径
+     */
+    const std::string& CurrentPath() const {
+        return _path;
+    }
+
+    /**
+     * @brief 因段文件不可用而丢弃的字节数
+     */
+    size_t DroppedBytes() const {
+        return _droppedBytes.load(std::memory_order_relaxed);
+    }
+
+    void Append(const char* data, size_t size) {
+        if (_base && _offset + size > _capacity) CloseSegment();
+        if (!_base && !Reopen(size > _segmentSize ? size : _segmentSize)) {
+            _droppedBytes.fetch_add(size, std::memory_order_relaxed);
+            return;
+        }
+        std::memcpy(_base + _offset, data, size);
+        _offset += size;
+    }
+
+    void Commit() {
+        if (RollIfDue()) return;
+        if (_offset - _synced >= _syncBytes) Sync();
+    }
+
+    void Tick() {
+        if (RollIfDue()) return;
+        Sync();
+    }
+
+private:
+    /**
+     * @brief 超过 rollInterval 且当前段非空时滚动
+     * @details 持续写入时写线程不会空闲，因此每批结束时也要检查
+     */
+    bool RollIfDue() {
+        if (_rollInterval.count() <= 0 || _offset == 0) return false;
+        if (std::chrono::steady_clock::now() - _openedAt < _rollInterval) return false;
+        CloseSegment();
+        Reopen(_segmentSize);
+        return true;
+    }
+
+    /**
+     * @brief 打开新段；上次失败后的退避期内直接返回 false
+     */
+    bool Reopen(size_t capacity) {
+        auto now = std::chrono::steady_clock::now();
+        if (now < _retryAt) return false;
+        if (OpenSegment(capacity)) {
+            _retryDelay = kRetryMin;
+            return true;
+        }
+        _retryAt = now + _retryDelay;
+        _retryDelay = _retryDelay * 2 < kRetryMax ? _retryDelay * 2 : kRetryMax;
+        return false;
+    }
+
+    /**
+     * @brief 创建、预分配并映射一个新段文件
+     * @return false 失败，_base 保持为 nullptr
+     */
+    bool OpenSegment(size_t capacity) {
+        char stamp[32];
+        std::time_t now = std::time(nullptr);
+        std::tm local_time{};
+        localtime_r(&now, &local_time);
+        std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &local_time);
+
+        _offset = 0;
+        _synced = 0;
+        _openedAt = std::chrono::steady_clock::now();
+
+        // 同名文件已存在时换下一个序号，不截断别人的日志
+        for (size_t attempt = 0; attempt < kMaxNameAttempts; ++attempt) {
+            char suffix[96];
+            std::snprintf(suffix, sizeof(suffix), ".%s.%ld.%zu.log", stamp, static_cast<long>(::getpid()), _sequence++);
+            _path = _basePath + suffix;
+            _fd = ::open(_path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+            if (_fd >= 0 || errno != EEXIST) break;
+        }
+        if (_fd < 0) return false;
+
+        // posix_fallocate 不被文件系统支持时退化为稀疏文件
+        if (::posix_fallocate(_fd, 0, static_cast<off_t>(capacity)) != 0 &&
+            ::ftruncate(_fd, static_cast<off_t>(capacity)) != 0) {
+            DiscardSegment();
+            return false;
+        }
+
+        void* base = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if (base == MAP_FAILED) {
+            DiscardSegment();
+            return false;
+        }
+        ::madvise(base, capacity, MADV_SEQUENTIAL);
+        _base = static_cast<char*>(base);
+        _capacity = capacity;
+        return true;
+    }
+
+    /**
+     * @brief 关闭并删除刚创建、尚未映射的段文件（避免留下空文件）
+     */
+    void DiscardSegment() {
+        ::close(_fd);
+        _fd = -1;
+        ::unlink(_path.c_str());
+    }
+
+    void CloseSegment() {
+        if (_base) {
+            ::msync(_base, _capacity, MS_ASYNC);
+            ::munmap(_base, _capacity);
+            _base = nullptr;
+        }
+        if (_fd >= 0) {
+            if (::ftruncate(_fd, static_cast<off_t>(_offset)) != 0) {}
+            ::close(_fd);
+            _fd = -1;
+        }
+        _capacity = 0;
+    }
+
+    /**
+     * @brief 对 [_synced, _offset) 发起异步回写，并释放已回写的整页
+     */
+    void Sync() {
+        if (!_base || _offset == _synced) return;
+        size_t begin = _synced & ~(_pageSize - 1);
+        ::msync(_base + begin, _offset - begin, MS_ASYNC);
+
+        // 最后一个不完整的页仍会被继续写入，保留映射
+        size_t end = _offset & ~(_pageSize - 1);
+        if (end > begin) ::madvise(_base + begin, end - begin, MADV_DONTNEED);
+        _synced = _offset;
+    }
+
+    static constexpr size_t kMaxNameAttempts = 64; ///< 同名文件已存在时最多尝试的序号数
+    static constexpr std::chrono::milliseconds kRetryMin{100};
+    static constexpr std::chrono::milliseconds kRetryMax{10000};
+
+    std::string _basePath;
+    size_t _segmentSize;
+    std::chrono::seconds _rollInterval;
+    size_t _syncBytes;
+    size_t _pageSize;
+
+    std::string _path;
+    size_t _sequence = 0;
+    int _fd = -1;
+    char* _base = nullptr;
+    size_t _capacity = 0;
+    size_t _offset = 0;   ///< 已写入字节数
+    size_t _synced = 0;   ///< 已发起回写的字节数
+    std::chrono::steady_clock::time_point _openedAt;
+    std::chrono::steady_clock::time_point _retryAt{};        ///< 打开失败后，下一次允许重试的时刻
+    std::chrono::milliseconds _retryDelay = kRetryMin;       ///< 下一次失败后的退避间隔
+    std::atomic<size_t> _droppedBytes{0};                    ///< 写线程写入，任意线程读取
+};
+
+/**
+ * @class MmapLogSink
+ * @brief 写入 mmap 滚动段文件的异步日志后端
+ *
+ * @details
+ * 前台队列、后台批次与 Stop() 语义同 AsyncLogSink；
+ * 写线程把格式化后的行（或 Write(std::string) 提交的已格式化文本）直接拷入映射区。
+ * 二进制日志（Log/BinaryLog.hpp）解码后同样经 Log::SetLogWriterFunc 进入本后端。
+ *
+ * @code
+ *   MmapLogSinkOptions options;
+ *   options.basePath = "/var/log/app/node";
+ *   options.segmentSize = 256u << 20;
+ *   MmapLogSink sink(options);
+ *   sink.Start();
+ *   Log::SetLogWriterFunc([&](const LogData& d) { sink.Write(d); });
+ *   LOGI() << "hello";
+ *   sink.Stop();
+ * @endcode
+ *
+ * @author BUG
+ * @date 2025-12-27
+ */
+class MmapLogSink : public BasicAsyncLogSink<MmapLogOutput> {
+public:
+    explicit MmapLogSink(const MmapLogSinkOptions& options = {})
+        : BasicAsyncLogSink(options.async, options)
+    {}
+
+    /**
+     * @brief 当前段文件是否映射成功
+     */
+    bool IsOpen() {
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        return _output.IsOpen();
+    }
+
+    /**
+     * @brief 当前段文件路径
+     */
+    std::string CurrentPath() {
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        return _output.CurrentPath();
+    }
+
+    /**
+     * @brief 因段文件打开 / 映射失败而丢弃的字节数
+     */
+    size_t DroppedBytes() const {
+        return _output.DroppedBytes();
+    }
+};
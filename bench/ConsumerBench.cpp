@@ -0,0 +1,132 @@
+/**
+ * @file ConsumerBench.cpp
+ * @brief ThreadConsumer 与 CoroutineConsumer 的吞吐与入队到处理的延迟
+ *
+ * @details
+ * - Throughput：producers 个线程各 AddTask() items / producers 个任务
+ *   （ThreadConsumer 满时在 AddTask 内等待空位，CoroutineConsumer 满时 yield 重试），
+ *   计时到回调处理完最后一个任务
+ * - Latency：每次只有一个任务在途，任务携带入队前的时间戳，回调中记录间隔
+ *   （hot 为连续提交，idle 为两次提交间休眠 200us、消费者已停车）
+ *
+ * 两种存储策略（Consumer/ConsumerStorage.h）分别测量：有界 RingQueueStorage<> 与无界 SegmentedStorage。
+ *
+ * 构建（CoroutineConsumer 需要 C++20 协程）：
+ *   g++ -std=c++20 -O2 -I.. ConsumerBench.cpp -o ConsumerBench -pthread
+ *
+ * 运行：
+ *   ./ConsumerBench [--repetitions=5] [--scale=1] [--filter=Coroutine]
+ *
+ * @author BUG
+ * @date 2025-12-28
+ */
+#include <Consumer/ThreadConsumer.hpp>
+#include <Consumer/CoroutineConsumer.hpp>
+
+#include "BenchUtil.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+static constexpr size_t kCapacity = 8192;
+
+static void WaitFor(const std::atomic<uint64_t>& counter, uint64_t target) {
+    while (counter.load(std::memory_order_acquire) < target) std::this_thread::yield();
+}
+
+/**
+ * @brief 吞吐：workers 对 ThreadConsumer 为线程数，对 CoroutineConsumer 为协程数
+ */
+template<typename Consumer>
+static BenchRun Throughput(size_t producers, int workers, size_t items) {
+    std::atomic<uint64_t> done{0};
+    Consumer consumer([&done](uint64_t) { done.fetch_add(1, std::memory_order_release); }, workers, kCapacity);
+    consumer.Start();
+
+    size_t perProducer = items / producers;
+    size_t total = perProducer * producers;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (size_t i = 0; i < perProducer; ++i) {
+                while (!consumer.AddTask(i)) std::this_thread::yield();
+            }
+        });
+    }
+
+    uint64_t start = BenchNowNs();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+    WaitFor(done, total);
+    BenchRun run{BenchNowNs() - start, total};
+    consumer.Stop();
+    return run;
+}
+
+template<typename Consumer>
+static LatencyHistogram Latency(int workers, size_t samples, bool idle) {
+    LatencyHistogram histogram;
+    std::atomic<uint64_t> done{0};
+    Consumer consumer(
+        [&](uint64_t submitted) {
+            histogram.Record(BenchNowNs() - submitted);
+            done.fetch_add(1, std::memory_order_release);
+        },
+        workers, kCapacity);
+    consumer.Start();
+
+    for (size_t i = 0; i < samples; ++i) {
+        if (idle) std::this_thread::sleep_for(std::chrono::microseconds(200));
+        while (!consumer.AddTask(BenchNowNs())) std::this_thread::yield();
+        WaitFor(done, i + 1);
+    }
+    consumer.Stop();
+    return histogram;
+}
+
+template<typename Consumer>
+static void RunAll(const BenchOptions& options, const std::string& prefix, int workers) {
+    size_t items = options.Scaled(1000000);
+    for (size_t producers : {1, 4}) {
+        std::string name = prefix + "/producers:" + std::to_string(producers);
+        BenchThroughput(options, name, [&] { return Throughput<Consumer>(producers, workers, items); });
+    }
+}
+
+template<typename Consumer>
+static void RunLatency(const BenchOptions& options, const std::string& prefix, int workers) {
+    for (bool idle : {false, true}) {
+        std::string name = prefix + (idle ? "/idle" : "/hot");
+        if (!options.Selected(name)) continue;
+        size_t samples = options.Scaled(idle ? 2000 : 100000);
+        BenchLatency(name, Latency<Consumer>(workers, samples, idle));
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = BenchOptions::Parse(argc, argv);
+
+    using ThreadRing = ThreadConsumer<uint64_t, RingQueueStorage<>>;
+    using ThreadSegmented = ThreadConsumer<uint64_t, SegmentedStorage>;
+    using CoroutineRing = CoroutineConsumer<uint64_t, RingQueueStorage<>>;
+    using CoroutineSegmented = CoroutineConsumer<uint64_t, SegmentedStorage>;
+
+    BenchHeader("consumer throughput");
+    RunAll<ThreadRing>(options, "ThreadConsumer/Ring/threads:1", 1);
+    RunAll<ThreadRing>(options, "ThreadConsumer/Ring/threads:4", 4);
+    RunAll<ThreadSegmented>(options, "ThreadConsumer/Segmented/threads:1", 1);
+    RunAll<CoroutineRing>(options, "CoroutineConsumer/Ring/coroutines:4", 4);
+    RunAll<CoroutineSegmented>(options, "CoroutineConsumer/Segmented/coroutines:4", 4);
+
+    std::printf("\n== add-to-callback latency\n");
+    RunLatency<ThreadRing>(options, "ThreadConsumer/Ring/threads:1", 1);
+    RunLatency<ThreadRing>(options, "ThreadConsumer/Ring/threads:4", 4);
+    RunLatency<ThreadSegmented>(options, "ThreadConsumer/Segmented/threads:1", 1);
+    RunLatency<CoroutineRing>(options, "CoroutineConsumer/Ring/coroutines:4", 4);
+    RunLatency<CoroutineSegmented>(options, "CoroutineConsumer/Segmented/coroutines:4", 4);
+    return 0;
+}
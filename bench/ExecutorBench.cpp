@@ -0,0 +1,276 @@
+/**
+ * @file ExecutorBench.cpp
+ * @brief ThreadExecutor / CoroutineExecutorMT 的吞吐与提交到执行的延迟分布
+ *
+ * @details
+ * - Throughput：调用线程连续提交 items 个空任务，计时到最后一个任务执行完；
+ *   Time 为每个任务的平均耗时（提交 + 调度 + 执行）
+ *   - 默认 TrySubmit，满时 yield 重试
+ *   - /blocking：Submit，满时由背压逻辑自旋 → yield → 停车等待空位
+ * - Latency：每次只有一个任务在途，记录提交前的时间戳到任务开始执行的间隔
+ *   - hot：上一个任务完成后立即提交，工作线程通常仍在自旋
+ *   - idle：两次提交之间休眠 200us，工作线程已停车 / 退避，包含唤醒成本
+ * - TaskType：捕获 32 字节（超出 std::function 的小对象缓冲）的任务，
+ *   std::function<void()> 每次提交都分配堆内存，InplaceTask<> 内联存储不分配
+ * - Overload：后台线程持续灌入约 2us 的批量任务使队列始终积压，同时测量交互任务的延迟
+ *   - /single：交互任务与批量任务共用一个队列，排在积压的批量任务之后
+ *   - /lanes:strict、/lanes:weighted(8:1)：批量任务进入低优先级通道（ExecutorLanes）
+ *
+ * ThreadExecutor 的任务为 std::function<void()>；CoroutineExecutorMT 的任务为时间戳，
+ * 由回调执行，任务直接推入外部 RingQueue。
+ *
+ * 构建（CoroutineExecutorMT 需要 C++20 协程）：
+ *   g++ -std=c++20 -O2 -I.. ExecutorBench.cpp -o ExecutorBench -pthread
+ *
+ * 运行：
+ *   ./ExecutorBench [--repetitions=5] [--scale=1] [--filter=ThreadExecutor]
+ *
+ * @author BUG
+ * @date 2025-12-28
+ */
+#include <Executor/ThreadExecutor.h>
+#include <Executor/CoroutineExecutorMT.h>
+#include <Executor/InplaceTask.h>
+
+#include "BenchUtil.h"
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+
+using Task = std::function<void()>;
+
+static constexpr size_t kQueueCapacity = 8192;
+
+static void WaitFor(const std::atomic<uint64_t>& counter, uint64_t target) {
+    while (counter.load(std::memory_order_acquire) < target) std::this_thread::yield();
+}
+
+static const char* ModeName(ThreadExecutorMode mode) {
+    return mode == ThreadExecutorMode::Shared ? "Shared" : "WorkStealing";
+}
+
+// ========================= ThreadExecutor =========================
+
+static BenchRun ThreadExecutorThroughput(size_t threads, ThreadExecutorMode mode, size_t items, bool blocking) {
+    LockFreeExecutor<Task> queue(kQueueCapacity);
+    ThreadExecutor<Task> executor(queue, threads, mode);
+    executor.Start();
+
+    std::atomic<uint64_t> done{0};
+    uint64_t start = BenchNowNs();
+    for (size_t i = 0; i < items; ++i) {
+        Task task = [&done] { done.fetch_add(1, std::memory_order_release); };
+        if (blocking) {
+            executor.Submit(std::move(task));
+        } else {
+            while (!executor.TrySubmit(std::move(task))) std::this_thread::yield();
+        }
+    }
+    WaitFor(done, items);
+    BenchRun run{BenchNowNs() - start, items};
+    executor.Stop();
+    return run;
+}
+
+template<typename TaskType>
+static BenchRun ThreadExecutorTaskType(size_t threads, ThreadExecutorMode mode, size_t items) {
+    LockFreeExecutor<TaskType> queue(kQueueCapacity);
+    ThreadExecutor<TaskType> executor(queue, threads, mode);
+    executor.Start();
+
+    std::atomic<uint64_t> done{0};
+    uint64_t start = BenchNowNs();
+    for (size_t i = 0; i < items; ++i) {
+        uint64_t a = i, b = i + 1, c = i + 2;
+        TaskType task([&done, a, b, c] {
+            BenchDoNotOptimize(a + b + c);
+            done.fetch_add(1, std::memory_order_release);
+        });
+        while (!executor.TrySubmit(std::move(task))) std::this_thread::yield();
+    }
+    WaitFor(done, items);
+    BenchRun run{BenchNowNs() - start, items};
+    executor.Stop();
+    return run;
+}
+
+static LatencyHistogram ThreadExecutorLatency(size_t threads, ThreadExecutorMode mode,
+                                              size_t samples, bool idle) {
+    LockFreeExecutor<Task> queue(kQueueCapacity);
+    ThreadExecutor<Task> executor(queue, threads, mode);
+    executor.Start();
+
+    LatencyHistogram histogram;
+    std::atomic<uint64_t> done{0};
+    for (size_t i = 0; i < samples; ++i) {
+        if (idle) std::this_thread::sleep_for(std::chrono::microseconds(200));
+        uint64_t submitted = BenchNowNs();
+        Task task = [&, submitted] {
+            histogram.Record(BenchNowNs() - submitted);
+            done.fetch_add(1, std::memory_order_release);
+        };
+        while (!executor.TrySubmit(std::move(task))) std::this_thread::yield();
+        WaitFor(done, i + 1);
+    }
+    executor.Stop();
+    return histogram;
+}
+
+static void BusyFor(uint64_t ns) {
+    uint64_t until = BenchNowNs() + ns;
+    while (BenchNowNs() < until) {}
+}
+
+static LatencyHistogram ThreadExecutorOverload(size_t threads, const ExecutorLanes& lanes, size_t samples) {
+    LockFreeExecutor<Task> queue(kQueueCapacity);
+    ThreadExecutor<Task> executor(queue, threads, ThreadExecutorMode::Shared, 256, lanes);
+    executor.Start();
+
+    size_t bulkLane = lanes.count - 1;
+    std::atomic<bool> flooding{true};
+    std::thread flooder([&] {
+        while (flooding.load(std::memory_order_relaxed)) {
+            if (!executor.TrySubmitTo(bulkLane, [] { BusyFor(2000); })) std::this_thread::yield();
+        }
+    });
+
+    LatencyHistogram histogram;
+    std::atomic<uint64_t> done{0};
+    for (size_t i = 0; i < samples; ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        uint64_t submitted = BenchNowNs();
+        Task task = [&, submitted] {
+            histogram.Record(BenchNowNs() - submitted);
+            done.fetch_add(1, std::memory_order_release);
+        };
+        while (!executor.TrySubmit(std::move(task))) std::this_thread::yield();
+        WaitFor(done, i + 1);
+    }
+    flooding.store(false, std::memory_order_relaxed);
+    flooder.join();
+    executor.Stop();
+    return histogram;
+}
+
+// ========================= CoroutineExecutorMT =========================
+
+using CoQueue = RingQueue<uint64_t>;
+
+static BenchRun CoroutineExecutorThroughput(size_t threads, size_t coroutines, size_t items) {
+    CoQueue queue(kQueueCapacity);
+    std::atomic<uint64_t> done{0};
+    CoroutineExecutorMT<uint64_t, CoQueue> executor(
+        queue, [&done](const uint64_t&) { done.fetch_add(1, std::memory_order_release); },
+        threads, coroutines);
+    executor.Start();
+
+    uint64_t start = BenchNowNs();
+    for (size_t i = 0; i < items; ++i) {
+        executor.Submit(i);
+    }
+    WaitFor(done, items);
+    BenchRun run{BenchNowNs() - start, items};
+    executor.Stop();
+    return run;
+}
+
+static LatencyHistogram CoroutineExecutorLatency(size_t threads, size_t coroutines,
+                                                 size_t samples, bool idle) {
+    CoQueue queue(kQueueCapacity);
+    LatencyHistogram histogram;
+    std::atomic<uint64_t> done{0};
+    CoroutineExecutorMT<uint64_t, CoQueue> executor(
+        queue,
+        [&](const uint64_t& submitted) {
+            histogram.Record(BenchNowNs() - submitted);
+            done.fetch_add(1, std::memory_order_release);
+        },
+        threads, coroutines);
+    executor.Start();
+
+    for (size_t i = 0; i < samples; ++i) {
+        if (idle) std::this_thread::sleep_for(std::chrono::microseconds(200));
+        while (!executor.TrySubmit(BenchNowNs())) std::this_thread::yield();
+        WaitFor(done, i + 1);
+    }
+    executor.Stop();
+    return histogram;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = BenchOptions::Parse(argc, argv);
+    size_t items = options.Scaled(1000000);
+    size_t hotSamples = options.Scaled(100000);
+    size_t idleSamples = options.Scaled(2000);
+    size_t overloadSamples = options.Scaled(500);
+    const size_t threadCounts[] = {1, 2, 4};
+    const ThreadExecutorMode modes[] = {ThreadExecutorMode::Shared, ThreadExecutorMode::WorkStealing};
+
+    BenchHeader("executor throughput");
+    for (ThreadExecutorMode mode : modes) {
+        for (size_t threads : threadCounts) {
+            std::string name = std::string("ThreadExecutor/") + ModeName(mode) + "/threads:" + std::to_string(threads);
+            BenchThroughput(options, name, [&] { return ThreadExecutorThroughput(threads, mode, items, false); });
+            BenchThroughput(options, name + "/blocking", [&] {
+                return ThreadExecutorThroughput(threads, mode, items, true);
+            });
+        }
+    }
+    for (size_t threads : threadCounts) {
+        std::string name = "CoroutineExecutorMT/threads:" + std::to_string(threads) + "/coroutines:4";
+        BenchThroughput(options, name, [&] { return CoroutineExecutorThroughput(threads, 4, items); });
+    }
+
+    BenchHeader("task type (32-byte capture)");
+    for (ThreadExecutorMode mode : modes) {
+        for (size_t threads : {size_t(1), size_t(2)}) {
+            std::string name = std::string("ThreadExecutor/") + ModeName(mode) + "/threads:" + std::to_string(threads);
+            BenchThroughput(options, name + "/std::function", [&] {
+                return ThreadExecutorTaskType<Task>(threads, mode, items);
+            });
+            BenchThroughput(options, name + "/InplaceTask", [&] {
+                return ThreadExecutorTaskType<InplaceTask<>>(threads, mode, items);
+            });
+        }
+    }
+
+    std::printf("\n== submit-to-execute latency\n");
+    for (bool idle : {false, true}) {
+        size_t samples = idle ? idleSamples : hotSamples;
+        const char* suffix = idle ? "/idle" : "/hot";
+        for (ThreadExecutorMode mode : modes) {
+            for (size_t threads : threadCounts) {
+                std::string name = std::string("ThreadExecutor/") + ModeName(mode) + "/threads:" +
+                                   std::to_string(threads) + suffix;
+                if (!options.Selected(name)) continue;
+                BenchLatency(name, ThreadExecutorLatency(threads, mode, samples, idle));
+            }
+        }
+        for (size_t threads : threadCounts) {
+            std::string name = "CoroutineExecutorMT/threads:" + std::to_string(threads) + "/coroutines:4" + suffix;
+            if (!options.Selected(name)) continue;
+            BenchLatency(name, CoroutineExecutorLatency(threads, 4, samples, idle));
+        }
+    }
+
+    std::printf("\n== interactive latency under bulk overload\n");
+    ExecutorLanes single;
+    ExecutorLanes strict;
+    strict.count = 2;
+    ExecutorLanes weighted;
+    weighted.count = 2;
+    weighted.weights = {8, 1};
+    const std::pair<const char*, const ExecutorLanes*> configs[] = {
+        {"single", &single}, {"lanes:strict", &strict}, {"lanes:weighted", &weighted}};
+    for (size_t threads : {size_t(1), size_t(2)}) {
+        for (const auto& [label, lanes] : configs) {
+            std::string name = "ThreadExecutor/Shared/threads:" + std::to_string(threads) + "/overload/" + label;
+            if (!options.Selected(name)) continue;
+            BenchLatency(name, ThreadExecutorOverload(threads, *lanes, overloadSamples));
+        }
+    }
+    return 0;
+}
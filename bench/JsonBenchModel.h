@@ -0,0 +1,83 @@
+/**
+ * @file JsonBenchModel.h
+ * @brief JSON 基准共用的代表性对象：订单（嵌套对象、对象数组、字符串数组、map）
+ *
+ * @author BUG
+ * @date 2025-12-28
+ */
+#pragma once
+
+#include <JsonSerializable/JsonSerializable.hpp>
+
+#include <string>
+#include <vector>
+
+class Item : public JsonSerializable {
+    FIELD(int, sku)
+    FIELD(std::string, title)
+    FIELD(double, price)
+    FIELD(std::vector<std::string>, tags)
+
+    JSON_SERIALIZE_FULL(JsonSerializable,
+        FIELD_PAIR(sku), FIELD_PAIR(title), FIELD_PAIR(price), FIELD_PAIR(tags))
+};
+
+class Customer : public JsonSerializable {
+    FIELD(int64_t, id)
+    FIELD(std::string, name)
+    FIELD(std::string, email)
+
+    JSON_SERIALIZE_FULL(JsonSerializable,
+        FIELD_PAIR(id), FIELD_PAIR(name), FIELD_PAIR(email))
+};
+
+class Order : public JsonSerializable {
+    FIELD(int64_t, id)
+    FIELD(Customer, customer)
+    FIELD(std::vector<Item>, items)
+    FIELD_MAP(int, std::string, notes)
+    FIELD(bool, paid)
+
+    JSON_SERIALIZE_FULL(JsonSerializable,
+        FIELD_PAIR(id), FIELD_PAIR(customer), FIELD_PAIR(items), FIELD_PAIR(notes), FIELD_PAIR(paid))
+    JSON_SERIALIZE_COMPLETE(Order)
+};
+
+class OrderBatch : public JsonSerializable {
+    FIELD(std::vector<Order>, orders)
+
+    JSON_SERIALIZE_FULL(JsonSerializable, FIELD_PAIR(orders))
+};
+
+/**
+ * @brief 生成 count 个代表性订单（每个含 4 个商品）
+ */
+inline std::vector<Order> MakeOrders(int count) {
+    std::vector<Order> all;
+    all.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        Customer c;
+        c.set_id(1000000 + i);
+        c.set_name("customer name " + std::to_string(i));
+        c.set_email("user" + std::to_string(i) + "@example.com");
+
+        std::vector<Item> items;
+        for (int k = 0; k < 4; ++k) {
+            Item item;
+            item.set_sku(i * 10 + k);
+            item.set_title("item title \"quoted\" " + std::to_string(k));
+            item.set_price(9.99 * (k + 1));
+            item.set_tags({"red", "large", "sale"});
+            items.push_back(item);
+        }
+
+        Order o;
+        o.set_id(i);
+        o.set_customer(c);
+        o.set_items(items);
+        o.set_notes({{1, "leave at door"}, {2, "fragile"}});
+        o.set_paid(i % 2 == 0);
+        all.push_back(o);
+    }
+    return all;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file JsonDeserializeBench.cpp
+ * @brief 大型嵌套数组的反序列化吞吐
+ *
+ * @details
+ * 生成一个由 Order 对象组成的 JSON 数组（每个 Order 含嵌套对象、对象数组、
+ * 字符串数组与 map），分别测量：
+ * - DOM：Json::CharReader 解析后经 from_json(const Json::Value&) 填充（只计填充时间 / 含解析时间）
+ * - 流式：from_json_array_string() 一次遍历直接填充
+ * - 二进制：同一批对象 write_binary() 后经 read_binary() 填充（JsonBinaryReader）
+ *
+ * 吞吐以输入 JSON 文本的 MB/s 计（二进制行按等价的 JSON 文本大小折算，便于直接比较）。
+ *
+ * 构建：
+ *   g++ -std=c++17 -O2 -I.. JsonDeserializeBench.cpp -o JsonDeserializeBench -ljsoncpp
+ *
+ * 运行：
+ *   ./JsonDeserializeBench [订单数，默认 50000]
+ *
+ * @author BUG
+ * @date 2025-12-27
+ */
+#include "JsonBenchModel.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+static std::string MakeInput(int orders) {
+    return Order::to_json_compact(MakeOrders(orders));
+}
+
+template<typename F>
+static double Seconds(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int orders = argc > 1 ? std::atoi(argv[1]) : 50000;
+    std::string text = MakeInput(orders);
+    double mb = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+    std::printf("input: %d orders, %.1f MB\n", orders, mb);
+
+    Json::Value root;
+    double parse = Seconds([&] {
+        Json::CharReaderBuilder builder;
+        std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+        std::string errors;
+        reader->parse(text.data(), text.data() + text.size(), &root, &errors);
+    });
+
+    std::vector<Order> dom;
+    double fill = Seconds([&] { dom = Order::from_json_array(root); });
+
+    std::vector<Order> pull;
+    double stream = Seconds([&] { pull = Order::from_json_array_string(text); });
+
+    OrderBatch batch;
+    batch.set_orders(pull);
+    std::vector<std::byte> binary;
+    batch.write_binary(binary);
+
+    OrderBatch decoded;
+    bool binaryOk = false;
+    double binaryRead = Seconds([&] { binaryOk = decoded.read_binary(binary); });
+
+    std::printf("binary: %.1f MB (%.1f%% of JSON)\n",
+                static_cast<double>(binary.size()) / (1024.0 * 1024.0),
+                100.0 * static_cast<double>(binary.size()) / static_cast<double>(text.size()));
+    std::printf("%-28s %8.1f MB/s\n", "DOM fill (from_json)", mb / fill);
+    std::printf("%-28s %8.1f MB/s\n", "DOM parse + fill", mb / (parse + fill));
+    std::printf("%-28s %8.1f MB/s\n", "stream (JsonReader)", mb / stream);
+    std::printf("%-28s %8.1f MB/s\n", "binary (JsonBinaryReader)", mb / binaryRead);
+
+    if (dom.size() != static_cast<size_t>(orders) || pull.size() != dom.size()) {
+        std::printf("size mismatch: %zu %zu\n", dom.size(), pull.size());
+        return 1;
+    }
+    if (!binaryOk || !decoded.get_orders() || decoded.get_orders()->size() != pull.size()) {
+        std::printf("binary round trip failed\n");
+        return 1;
+    }
+    return 0;
+}
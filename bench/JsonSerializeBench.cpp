@@ -0,0 +1,175 @@
+/**
+ * @file JsonSerializeBench.cpp
+ * @brief 代表性对象的逐对象序列化 / 反序列化成本
+ *
+ * @details
+ * 对 JsonBenchModel.h 中的 Order（嵌套 Customer、4 个 Item、map）逐个测量：
+ * - 序列化：to_json()（DOM）、to_json_string()（DOM + StreamWriter）、to_json_compact()、
+ *   write_json()（复用缓冲区）、write_binary()
+ * - 反序列化：from_json(const Json::Value&)、read_json()（JsonReader）、read_binary()、
+ *   Json::CharReader 解析 + from_json
+ * - 增量：字段较多、声明了 JSON_DIRTY_TRACKING 的 Profile 每轮修改一个字段后
+ *   to_json_compact() / to_json_cached() / to_json_delta() 的成本
+ *
+ * Time 为每个对象的耗时。
+ *
+ * 构建：
+ *   g++ -std=c++17 -O2 -I.. JsonSerializeBench.cpp -o JsonSerializeBench -ljsoncpp
+ *
+ * 运行：
+ *   ./JsonSerializeBench [--repetitions=5] [--scale=1] [--filter=Order/write]
+ *
+ * @author BUG
+ * @date 2025-12-28
+ */
+#include "JsonBenchModel.h"
+#include "BenchUtil.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class Profile : public JsonSerializable {
+    JSON_DIRTY_TRACKING(Profile)
+    FIELD(int64_t, id)
+    FIELD(std::string, name)
+    FIELD(std::string, email)
+    FIELD(int, age)
+    FIELD(double, balance)
+    FIELD(bool, active)
+    FIELD(Customer, referrer)
+    FIELD(std::vector<Item>, history)
+    FIELD(std::vector<std::string>, roles)
+    FIELD_MAP(std::string, int, counters)
+
+    JSON_SERIALIZE_FULL(JsonSerializable,
+        FIELD_PAIR(id), FIELD_PAIR(name), FIELD_PAIR(email), FIELD_PAIR(age), FIELD_PAIR(balance),
+        FIELD_PAIR(active), FIELD_PAIR(referrer), FIELD_PAIR(history), FIELD_PAIR(roles), FIELD_PAIR(counters))
+    JSON_SERIALIZE_COMPLETE(Profile)
+};
+
+static Profile MakeProfile(const std::vector<Order>& orders) {
+    Profile p;
+    p.set_id(42);
+    p.set_name("profile name");
+    p.set_email("profile@example.com");
+    p.set_age(30);
+    p.set_balance(1234.5);
+    p.set_active(true);
+    p.set_referrer(*orders.front().get_customer());
+    std::vector<Item> history;
+    for (const Order& o : orders) {
+        for (const Item& item : *o.get_items()) history.push_back(item);
+    }
+    p.set_history(history);
+    p.set_roles({"admin", "editor", "viewer"});
+    p.set_counters({{"login", 10}, {"logout", 9}, {"purchase", 3}});
+    return p;
+}
+
+template<typename F>
+static BenchRun Each(size_t count, F&& f) {
+    uint64_t start = BenchNowNs();
+    for (size_t i = 0; i < count; ++i) f(i);
+    return BenchRun{BenchNowNs() - start, count};
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = BenchOptions::Parse(argc, argv);
+    const int count = static_cast<int>(options.Scaled(20000));
+    std::vector<Order> orders = MakeOrders(count);
+
+    std::vector<Json::Value> doms;
+    std::vector<std::string> texts;
+    std::vector<std::vector<std::byte>> binaries;
+    for (const Order& o : orders) {
+        doms.push_back(o.to_json());
+        texts.push_back(o.to_json_compact());
+        binaries.emplace_back();
+        o.write_binary(binaries.back());
+    }
+
+    BenchHeader("Order serialize");
+    BenchThroughput(options, "Order/to_json", [&] {
+        return Each(orders.size(), [&](size_t i) { BenchDoNotOptimize(orders[i].to_json()); });
+    });
+    BenchThroughput(options, "Order/to_json_string", [&] {
+        return Each(orders.size(), [&](size_t i) { BenchDoNotOptimize(orders[i].to_json_string()); });
+    });
+    BenchThroughput(options, "Order/to_json_compact", [&] {
+        return Each(orders.size(), [&](size_t i) { BenchDoNotOptimize(orders[i].to_json_compact()); });
+    });
+    BenchThroughput(options, "Order/write_json/reused_buffer", [&] {
+        std::string buffer;
+        return Each(orders.size(), [&](size_t i) {
+            buffer.clear();
+            orders[i].write_json(buffer);
+            BenchDoNotOptimize(buffer);
+        });
+    });
+    BenchThroughput(options, "Order/write_binary/reused_buffer", [&] {
+        std::vector<std::byte> buffer;
+        return Each(orders.size(), [&](size_t i) {
+            buffer.clear();
+            orders[i].write_binary(buffer);
+            BenchDoNotOptimize(buffer);
+        });
+    });
+
+    BenchHeader("Order deserialize");
+    BenchThroughput(options, "Order/from_json/Json::Value", [&] {
+        return Each(orders.size(), [&](size_t i) {
+            Order o;
+            o.from_json(doms[i]);
+            BenchDoNotOptimize(o);
+        });
+    });
+    BenchThroughput(options, "Order/parse+from_json/Json::CharReader", [&] {
+        Json::CharReaderBuilder builder;
+        std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+        return Each(orders.size(), [&](size_t i) {
+            Json::Value root;
+            std::string errors;
+            reader->parse(texts[i].data(), texts[i].data() + texts[i].size(), &root, &errors);
+            Order o;
+            o.from_json(root);
+            BenchDoNotOptimize(o);
+        });
+    });
+    BenchThroughput(options, "Order/read_json/JsonReader", [&] {
+        return Each(orders.size(), [&](size_t i) {
+            Order o;
+            BenchDoNotOptimize(o.read_json(texts[i]));
+        });
+    });
+    BenchThroughput(options, "Order/read_binary", [&] {
+        return Each(orders.size(), [&](size_t i) {
+            Order o;
+            BenchDoNotOptimize(o.read_binary(binaries[i]));
+        });
+    });
+
+    BenchHeader("Profile incremental (one field changed per call)");
+    std::vector<Order> head(orders.begin(), orders.begin() + std::min<size_t>(orders.size(), 16));
+    Profile profile = MakeProfile(head);
+    const size_t rounds = options.Scaled(20000);
+    BenchThroughput(options, "Profile/to_json_compact", [&] {
+        return Each(rounds, [&](size_t i) {
+            profile.set_age(static_cast<int>(i));
+            BenchDoNotOptimize(profile.to_json_compact());
+        });
+    });
+    BenchThroughput(options, "Profile/to_json_cached", [&] {
+        return Each(rounds, [&](size_t i) {
+            profile.set_age(static_cast<int>(i));
+            BenchDoNotOptimize(profile.to_json_cached());
+        });
+    });
+    BenchThroughput(options, "Profile/to_json_delta", [&] {
+        return Each(rounds, [&](size_t i) {
+            profile.set_age(static_cast<int>(i));
+            BenchDoNotOptimize(profile.to_json_delta());
+        });
+    });
+    return 0;
+}
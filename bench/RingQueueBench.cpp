@@ -0,0 +1,128 @@
+/**
+ * @file RingQueueBench.cpp
+ * @brief RingQueue 在 1..N 个生产者 / 消费者下的 push/pop 吞吐
+ *
+ * @details
+ * - SingleThread：同一线程交替 TryPush / TryPop，测量无竞争时单次操作成本
+ * - SPSC / MPMC：P 个生产者各推入 items / P 个元素，C 个消费者弹出直到总数达到 items，
+ *   计时从所有线程放行开始到全部线程结束；Throughput 为每秒完成的 push + pop 对数
+ * - 队列满 / 空时（含 Busy）原地自旋重试，结果包含竞争带来的重试成本
+ *
+ * 构建：
+ *   g++ -std=c++17 -O2 -I.. RingQueueBench.cpp -o RingQueueBench -pthread
+ *
+ * 运行：
+ *   ./RingQueueBench [--repetitions=5] [--scale=1] [--filter=MPMC]
+ *
+ * @author BUG
+ * @date 2025-12-28
+ */
+#include <Containers/RingQueue.h>
+
+#include "BenchUtil.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static constexpr size_t kCapacity = 4096;
+
+/**
+ * @brief 单线程交替 push / pop
+ */
+template<typename Queue>
+static BenchRun RunSingleThread(size_t items) {
+    Queue queue(kCapacity);
+    uint64_t start = BenchNowNs();
+    uint64_t value = 0;
+    for (size_t i = 0; i < items; ++i) {
+        queue.TryPush(i);
+        queue.TryPop(value);
+        BenchDoNotOptimize(value);
+    }
+    return BenchRun{BenchNowNs() - start, items};
+}
+
+/**
+ * @brief P 个生产者、C 个消费者并发 push / pop
+ */
+template<typename Queue>
+static BenchRun RunConcurrent(size_t producers, size_t consumers, size_t items) {
+    Queue queue(kCapacity);
+    std::atomic<bool> go{false};
+    std::atomic<size_t> consumed{0};
+    std::vector<std::thread> threads;
+    size_t perProducer = items / producers;
+    size_t total = perProducer * producers;
+
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            while (!go.load(std::memory_order_acquire)) {}
+            uint64_t base = static_cast<uint64_t>(p) * perProducer;
+            for (size_t i = 0; i < perProducer; ++i) {
+                while (queue.TryPush(base + i) != RingQueueResult::Ok) std::this_thread::yield();
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {}
+            uint64_t value = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.TryPop(value) == RingQueueResult::Ok) {
+                    BenchDoNotOptimize(value);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    uint64_t start = BenchNowNs();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+    return BenchRun{BenchNowNs() - start, total};
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = BenchOptions::Parse(argc, argv);
+    size_t singleItems = options.Scaled(10000000);
+    size_t concurrentItems = options.Scaled(2000000);
+
+    BenchHeader("RingQueue single thread");
+    BenchThroughput(options, "RingQueue/SingleThread/MPMC", [&] {
+        return RunSingleThread<RingQueue<uint64_t>>(singleItems);
+    });
+    BenchThroughput(options, "RingQueue/SingleThread/SPSC", [&] {
+        return RunSingleThread<RingQueue<uint64_t, Producers::Single, Consumers::Single>>(singleItems);
+    });
+    BenchThroughput(options, "RingQueue/SingleThread/MPMC/Padded", [&] {
+        return RunSingleThread<RingQueue<uint64_t, Producers::Multi, Consumers::Multi, NodeLayout::Padded>>(singleItems);
+    });
+
+    BenchHeader("RingQueue concurrent");
+    BenchThroughput(options, "RingQueue/SPSC/P:1/C:1", [&] {
+        return RunConcurrent<RingQueue<uint64_t, Producers::Single, Consumers::Single>>(1, 1, concurrentItems);
+    });
+    BenchThroughput(options, "RingQueue/MPSC/P:4/C:1", [&] {
+        return RunConcurrent<RingQueue<uint64_t, Producers::Multi, Consumers::Single>>(4, 1, concurrentItems);
+    });
+    BenchThroughput(options, "RingQueue/SPMC/P:1/C:4", [&] {
+        return RunConcurrent<RingQueue<uint64_t, Producers::Single, Consumers::Multi>>(1, 4, concurrentItems);
+    });
+    const size_t counts[] = {1, 2, 4, 8};
+    for (size_t producers : counts) {
+        for (size_t consumers : counts) {
+            std::string name = "RingQueue/MPMC/P:" + std::to_string(producers) + "/C:" + std::to_string(consumers);
+            BenchThroughput(options, name, [&] {
+                return RunConcurrent<RingQueue<uint64_t>>(producers, consumers, concurrentItems);
+            });
+        }
+    }
+    BenchThroughput(options, "RingQueue/MPMC/Padded/P:4/C:4", [&] {
+        return RunConcurrent<RingQueue<uint64_t, Producers::Multi, Consumers::Multi, NodeLayout::Padded>>(
+            4, 4, concurrentItems);
+    });
+    return 0;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file CoroutineExecutorMTTest.cpp
+ * @brief CoroutineExecutorMT 的停车与唤醒
+ *
+ * @details
+ * - 空闲时工作线程停车直到被唤醒，不再周期性重新轮询（emptyPolls / parks 不随时间增长）
+ * - TrySubmit / Submit / TrySubmitTo、Schedule() 与 Notify()（直接推入外部队列时）都能唤醒停车的工作线程
+ * - Start() 之前与 Stop() 之后拒绝提交；工作线程停车时 Stop() 正常返回
+ *
+ * 构建（在 tests/ 下）：
+ *   g++ -std=c++20 -O1 -g -DEXECUTOR_METRICS -fsanitize=address,undefined -I.. CoroutineExecutorMTTest.cpp -o CoroutineExecutorMTTest -pthread
+ *
+ * @author BUG
+ * @date 2025-12-31
+ */
+#include <Executor/CoroutineExecutorMT.h>
+
+#include "TestUtil.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using Queue = RingQueue<uint64_t>;
+using Executor = CoroutineExecutorMT<uint64_t, Queue>;
+
+static bool WaitUntil(const std::atomic<size_t>& value, size_t expected) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (value.load() < expected) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    return true;
+}
+
+/**
+ * 停车中的工作线程只有被唤醒才会重新轮询
+ */
+static void IdleWorkersStayParked() {
+    Queue queue(64);
+    std::atomic<size_t> done{0};
+    Executor exec(queue, [&](const uint64_t&) { done.fetch_add(1); }, 2, 4);
+    exec.Start();
+
+    CHECK(exec.TrySubmit(1));
+    CHECK(WaitUntil(done, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    size_t polls = exec.Stats().emptyPolls;
+    size_t parks = exec.Metrics().parks;
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    CHECK(exec.Stats().emptyPolls == polls);
+    CHECK(exec.Metrics().parks == parks);
+    exec.Stop();
+}
+
+/**
+ * 每种提交方式在工作线程停车后都能让任务立即被执行
+ */
+static void SubmissionsWakeParkedWorkers() {
+    Queue queue(64);
+    Queue low(64);
+    std::atomic<size_t> done{0};
+    Executor exec(queue, [&](const uint64_t&) { done.fetch_add(1); }, 2, 4);
+    exec.SetLanes({&low});
+    exec.Start();
+
+    auto idle = [] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); };
+
+    idle();
+    CHECK(exec.TrySubmit(1));
+    CHECK(WaitUntil(done, 1));
+
+    idle();
+    CHECK(exec.Submit(2));
+    CHECK(WaitUntil(done, 2));
+
+    idle();
+    CHECK(exec.TrySubmitTo(1, 3));
+    CHECK(WaitUntil(done, 3));
+
+    idle();
+    CHECK(exec.TrySubmitTo(7, 4));
+    CHECK(WaitUntil(done, 4));
+
+    idle();
+    CHECK(queue.TryPush(5) == RingQueueResult::Ok);
+    exec.Notify();
+    CHECK(WaitUntil(done, 5));
+
+    exec.Stop();
+#ifdef EXECUTOR_METRICS
+    CHECK(exec.Metrics().submitted == 4);
+#endif
+}
+
+/**
+ * 协程内 co_await Schedule() 挂起后由停车的工作线程恢复
+ */
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+static Detached ResumeOn(Executor& exec, std::atomic<size_t>& resumed) {
+    co_await exec.Schedule();
+    resumed.fetch_add(1);
+}
+
+static void ScheduleWakesParkedWorkers() {
+    Queue queue(64);
+    Executor exec(queue, [](const uint64_t&) {}, 2, 4);
+    exec.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    std::atomic<size_t> resumed{0};
+    ResumeOn(exec, resumed);
+    CHECK(WaitUntil(resumed, 1));
+    exec.Stop();
+}
+
+/**
+ * 未运行时拒绝提交；满队列上的 Submit 在 Stop() 后返回 false
+ */
+static void RejectsWhenStopped() {
+    Queue queue(4);
+    std::atomic<size_t> done{0};
+    Executor exec(queue, [&](const uint64_t&) { done.fetch_add(1); }, 1, 1);
+
+    CHECK(!exec.TrySubmit(1));
+    CHECK(!exec.Submit(1));
+    CHECK(queue.SizeApprox() == 0);
+
+    exec.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    exec.Stop();
+
+    CHECK(!exec.TrySubmit(1));
+    CHECK(!exec.Submit(1));
+    CHECK(!exec.TrySubmitTo(0, 1));
+    CHECK(queue.SizeApprox() == 0);
+    CHECK(done.load() == 0);
+}
+
+/**
+ * 生产者在满队列上等待空位时 Stop()：Submit 返回 false 而不是永久阻塞
+ */
+static void StopReleasesBlockedSubmit() {
+    Queue queue(2);
+    std::atomic<bool> release{false};
+    Executor exec(queue, [&](const uint64_t&) {
+        while (!release.load()) std::this_thread::yield();
+    }, 1, 1);
+    exec.Start();
+
+    std::atomic<size_t> accepted{0};
+    std::atomic<bool> finished{false};
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < 16; ++i) {
+            if (!exec.Submit(i)) break;
+            accepted.fetch_add(1);
+        }
+        finished = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(!finished.load());
+
+    std::thread stopper([&] { exec.Stop(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    release = true;
+    stopper.join();
+    producer.join();
+    CHECK(finished.load());
+    CHECK(accepted.load() < 16);
+}
+
+int main() {
+    IdleWorkersStayParked();
+    SubmissionsWakeParkedWorkers();
+    ScheduleWakesParkedWorkers();
+    RejectsWhenStopped();
+    StopReleasesBlockedSubmit();
+    return TestResult();
+}
@@ -0,0 +1,117 @@
+/**
+ * @file ExecutorStopTest.cpp
+ * @brief ThreadExecutor / CoroutineExecutor 在 Start() 之前与 Stop() 之后的提交语义
+ *
+ * @details
+ * - 未运行时 TrySubmit / Submit / SubmitFor / SubmitBulk 一律拒绝，任务不进入队列
+ * - SubmitOrRun 与结果包装（ThreadExecutorResult / CoroutineExecutorResult）在调用线程执行
+ * - 多个生产者与 Stop() 并发：每个任务要么被执行，要么被拒绝，不会滞留在队列中
+ *
+ * 构建（在 tests/ 下）：
+ *   g++ -std=c++20 -O1 -g -fsanitize=address,undefined -I.. ExecutorStopTest.cpp -o ExecutorStopTest -pthread
+ *
+ * @author BUG
+ * @date 2025-12-31
+ */
+#include <Executor/ThreadExecutor.h>
+#include <Executor/ThreadExecutorResult.h>
+#include <Executor/CoroutineExecutor.h>
+#include <Executor/CoroutineExecutorResult.h>
+
+#include "TestUtil.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using Task = std::function<void()>;
+
+static void ThreadExecutorRejectsWhenStopped(ThreadExecutorMode mode) {
+    LockFreeExecutor<Task> queue(64);
+    ThreadExecutor<Task> exec(queue, 2, mode);
+    std::atomic<int> ran{0};
+    Task task = [&] { ran.fetch_add(1); };
+
+    CHECK(!exec.TrySubmit(task));
+    CHECK(!exec.Submit(task));
+    CHECK(queue.SizeApprox() == 0);
+
+    exec.Start();
+    CHECK(exec.Submit(task));
+    exec.Stop();
+    size_t left = queue.SizeApprox();
+
+    CHECK(!exec.TrySubmit(task));
+    CHECK(!exec.Submit(task));
+    CHECK(!exec.SubmitFor(task, std::chrono::milliseconds(10)));
+    std::vector<Task> bulk(4, task);
+    CHECK(exec.SubmitBulk(bulk.begin(), bulk.end()) == 0);
+    CHECK(queue.SizeApprox() == left);
+
+    int before = ran.load();
+    CHECK(!exec.SubmitOrRun(task));
+    CHECK(ran.load() == before + 1);
+
+    ThreadExecutorResult<int> result(exec);
+    CHECK(result.Submit([] { return 7; }) == 7);
+    CHECK(result.SubmitAsync([] { return 8; }).Get() == 8);
+}
+
+static void CoroutineExecutorRejectsWhenStopped() {
+    LockFreeExecutor<Task> queue(64);
+    CoroutineExecutor<Task> exec(queue, 2);
+    Task task = [] {};
+
+    CHECK(!exec.TrySubmit(task));
+    exec.Start();
+    CHECK(exec.Submit(task));
+    exec.Stop();
+    size_t left = queue.SizeApprox();
+
+    CHECK(!exec.TrySubmit(task));
+    CHECK(!exec.Submit(task));
+    CHECK(queue.SizeApprox() == left);
+
+    CoroutineExecutorResult<int> result(exec);
+    CHECK(result.Submit([] { return 7; }) == 7);
+    CHECK(result.SubmitAsync([] { return 8; }).Get() == 8);
+}
+
+/**
+ * 生产者与 Stop() 并发：Stop() 返回后队列不再增长
+ */
+static void StopRacesWithProducers() {
+    for (int round = 0; round < 50; ++round) {
+        LockFreeExecutor<Task> queue(1024);
+        ThreadExecutor<Task> exec(queue, 2);
+        std::atomic<bool> go{true};
+        exec.Start();
+
+        std::vector<std::thread> producers;
+        for (int i = 0; i < 4; ++i) {
+            producers.emplace_back([&] {
+                while (go.load()) {
+                    exec.TrySubmit(Task([] {}));
+                }
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        exec.Stop();
+        size_t left = queue.SizeApprox();
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        CHECK(queue.SizeApprox() == left);
+
+        go = false;
+        for (auto& t : producers) t.join();
+        CHECK(queue.SizeApprox() == left);
+    }
+}
+
+int main() {
+    ThreadExecutorRejectsWhenStopped(ThreadExecutorMode::Shared);
+    ThreadExecutorRejectsWhenStopped(ThreadExecutorMode::WorkStealing);
+    CoroutineExecutorRejectsWhenStopped();
+    StopRacesWithProducers();
+    return TestResult();
+}
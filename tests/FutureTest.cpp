@@ -0,0 +1,151 @@
+/**
+ * @file FutureTest.cpp
+ * @brief Future / Promise 的结果、异常与 broken_promise 传递
+ *
+ * @details
+ * - 最后一个 Promise 未写入结果就析构：Get() / Then() / co_await 得到 broken_promise 而不是永久阻塞
+ * - Promise 拷贝共享写入端计数，只有最后一个拷贝析构时才判定
+ * - ThreadExecutor::Stop() 时仍在队列中的 SubmitAsync 任务、已过期被丢弃的 DeadlineTask
+ * - 续体任务被丢弃时，续体结果同样以 broken_promise 完成
+ *
+ * 构建（在 tests/ 下）：
+ *   g++ -std=c++20 -O1 -g -fsanitize=address,undefined -I.. FutureTest.cpp -o FutureTest -pthread
+ *
+ * @author BUG
+ * @date 2025-12-31
+ */
+#include <Executor/Future.h>
+#include <Executor/CoroutineTask.h>
+#include <Executor/ExecutorLanes.h>
+#include <Executor/ThreadExecutor.h>
+#include <Executor/ThreadExecutorResult.h>
+
+#include "TestUtil.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <optional>
+#include <stdexcept>
+
+/// Get() 是否抛出 broken_promise
+template<typename R>
+static bool IsBroken(Future<R>& future) {
+    try {
+        future.Get();
+    } catch (const std::future_error& e) {
+        return e.code() == std::future_errc::broken_promise;
+    }
+    return false;
+}
+
+static void DroppedPromiseBreaks() {
+    std::optional<Future<int>> future;
+    {
+        auto [promise, f] = MakePromise<int>();
+        Promise<int> copy = promise;
+        future.emplace(std::move(f));
+        (void)copy;
+    }
+    CHECK(future->IsReady());
+    CHECK(IsBroken(*future));
+
+    auto [promise, f] = MakePromise<int>();
+    Promise<int> copy = promise;
+    { Promise<int> drop = std::move(promise); }
+    CHECK(!f.IsReady());
+    copy.SetValue(5);
+    { Promise<int> last = std::move(copy); }
+    CHECK(f.Get() == 5);
+}
+
+static void BrokenPropagatesThroughThen() {
+    Future<int> chained;
+    {
+        auto [promise, f] = MakePromise<int>();
+        chained = f.Then([](int v) { return v + 1; });
+    }
+    CHECK(IsBroken(chained));
+
+    // 续体任务被丢弃而未执行：续体结果以 broken_promise 完成
+    FutureExecutor drop{nullptr, [](void*, std::function<void()>&& fn) {
+        std::function<void()> discarded = std::move(fn);
+        return true;
+    }};
+    auto [promise, f] = MakePromise<int>(drop);
+    Future<int> next = f.Then([](int v) { return v * 2; });
+    promise.SetValue(1);
+    CHECK(IsBroken(next));
+}
+
+static void CoAwaitSeesBroken() {
+    auto [promise, f] = MakePromise<int>();
+    Future<int> future = std::move(f);
+    auto waiter = [&]() -> CoTask<bool> {
+        try {
+            co_await future;
+        } catch (const std::future_error&) {
+            co_return true;
+        }
+        co_return false;
+    };
+    std::thread dropper([p = std::move(promise)]() mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        Promise<int> last = std::move(p);
+    });
+    CHECK(SyncWait(waiter()));
+    dropper.join();
+}
+
+using Task = std::function<void()>;
+
+static void StopBreaksQueuedTasks() {
+    LockFreeExecutor<Task> queue(64);
+    ThreadExecutor<Task> exec(queue, 1);
+    ThreadExecutorResult<int, Task> result(exec);
+    exec.Start();
+
+    std::promise<void> gate;
+    std::shared_future<void> open = gate.get_future().share();
+    std::atomic<bool> started{false};
+    Future<int> first = result.SubmitAsync([open, &started] { started = true; open.wait(); return 1; });
+    // 工作线程取走一批后才提交其余任务，保证它们在 Stop() 时仍在队列中
+    while (!started.load()) std::this_thread::yield();
+    Future<int> second = result.SubmitAsync([] { return 2; });
+    Future<int> chained = result.SubmitAsync([] { return 3; }).Then([](int v) { return v; });
+
+    std::thread stopper([&] { exec.Stop(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    gate.set_value();
+    stopper.join();
+
+    CHECK(first.Get() == 1);
+    CHECK(IsBroken(second));
+    CHECK(IsBroken(chained));
+    CHECK(queue.SizeApprox() == 0);
+}
+
+static void ShedDeadlineTaskBreaks() {
+    using Timed = DeadlineTask<Task>;
+    LockFreeExecutor<Timed> queue(64);
+    ThreadExecutor<Timed> exec(queue, 1);
+    exec.Start();
+
+    auto [promise, future] = MakePromise<int>();
+    Timed task([p = promise]() mutable { p.SetValue(1); },
+               std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    { Promise<int> drop = std::move(promise); }
+    CHECK(exec.Submit(std::move(task)));
+    CHECK(IsBroken(future));
+    exec.Stop();
+}
+
+int main() {
+    DroppedPromiseBreaks();
+    BrokenPropagatesThroughThen();
+    CoAwaitSeesBroken();
+    StopBreaksQueuedTasks();
+    ShedDeadlineTaskBreaks();
+    return TestResult();
+}
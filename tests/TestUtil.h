@@ -0,0 +1,35 @@
+#pragma once
+
+/**
+ * @file TestUtil.h
+ * @brief tests/ 下单文件测试程序的公共断言
+ *
+ * @details
+ * CHECK 失败时打印位置与表达式并继续执行，main 以 TestResult() 作为退出码
+ *
+ * @author BUG
+ * @date 2025-12-31
+ */
+#include <cstdio>
+
+inline int& TestFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(expr)                                                         \
+    do {                                                                    \
+        if (!(expr)) {                                                      \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr); \
+            ++TestFailures();                                               \
+        }                                                                   \
+    } while (0)
+
+inline int TestResult() {
+    if (TestFailures() == 0) {
+        std::printf("OK\n");
+        return 0;
+    }
+    std::fprintf(stderr, "%d check(s) failed\n", TestFailures());
+    return 1;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file ThreadConsumerTest.cpp
+ * @brief ThreadConsumer 的背压、停止与并发提交
+ *
+ * @details
+ * - 远超队列容量的突发提交全部被处理（AddTask 满时等待空位，不丢任务）
+ * - TryAddTask 在队列满时立即返回 false
+ * - 回调内 AddTask 且队列已满时在工作线程上直接执行，不自锁
+ * - Start() 前 / Stop() 后 AddTask 返回 false
+ * - 生产者与 Stop(true) 并发：每个被接受的任务都恰好处理一次
+ *
+ * 构建（在 tests/ 下）：
+ *   g++ -std=c++17 -O1 -g -fsanitize=address,undefined -I.. ThreadConsumerTest.cpp -o ThreadConsumerTest -pthread
+ *
+ * @author BUG
+ * @date 2025-12-31
+ */
+#include <Consumer/ThreadConsumer.hpp>
+
+#include "TestUtil.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static void BurstIsNotLost() {
+    std::atomic<int> done{0};
+    ThreadConsumer<int> consumer([&](int) { done.fetch_add(1); }, 2, 16);
+    consumer.Start();
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p) {
+        producers.emplace_back([&] {
+            for (int i = 0; i < 5000; ++i) CHECK(consumer.AddTask(i));
+        });
+    }
+    for (auto& t : producers) t.join();
+    consumer.Stop(true);
+    CHECK(done.load() == 20000);
+}
+
+static void TryAddTaskFailsWhenFull() {
+    std::atomic<bool> release{false};
+    ThreadConsumer<int> consumer([&](int) { while (!release.load()) std::this_thread::yield(); }, 1, 4);
+    consumer.Start();
+
+    int accepted = 0;
+    for (int i = 0; i < 64; ++i) accepted += consumer.TryAddTask(i) ? 1 : 0;
+    CHECK(accepted < 64);
+    release = true;
+    consumer.Stop(true);
+}
+
+static void ReentrantAddTaskRunsInline() {
+    std::atomic<int> done{0};
+    ThreadConsumer<int>* self = nullptr;
+    ThreadConsumer<int> consumer([&](int depth) {
+        done.fetch_add(1);
+        if (depth > 0) {
+            for (int i = 0; i < 8; ++i) CHECK(self->AddTask(depth - 1));
+        }
+    }, 1, 2);
+    self = &consumer;
+    consumer.Start();
+    CHECK(consumer.AddTask(3));
+    // Stop() 之后回调内的 AddTask 会被拒绝，先等整棵任务树处理完
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (done.load() < 1 + 8 + 64 + 512 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+    consumer.Stop(true);
+    CHECK(done.load() == 1 + 8 + 64 + 512);
+}
+
+static void RejectsWhenStopped() {
+    ThreadConsumer<int> consumer([](int) {}, 1, 16);
+    CHECK(!consumer.AddTask(1));
+    CHECK(!consumer.TryAddTask(1));
+    consumer.Start();
+    consumer.Stop();
+    CHECK(!consumer.AddTask(1));
+    CHECK(consumer.size() == 0);
+}
+
+static void StopRacesWithProducers() {
+    for (int round = 0; round < 50; ++round) {
+        std::atomic<int> accepted{0};
+        std::atomic<int> done{0};
+        ThreadConsumer<int> consumer([&](int) { done.fetch_add(1); }, 2, 64);
+        consumer.Start();
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < 4; ++p) {
+            producers.emplace_back([&] {
+                for (int i = 0; i < 2000; ++i) {
+                    if (!consumer.AddTask(i)) break;
+                    accepted.fetch_add(1);
+                }
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        consumer.Stop(true);
+        int handled = done.load();
+        for (auto& t : producers) t.join();
+        CHECK(accepted.load() == handled);
+        CHECK(done.load() == handled);
+        CHECK(consumer.size() == 0);
+    }
+}
+
+int main() {
+    BurstIsNotLost();
+    TryAddTaskFailsWhenFull();
+    ReentrantAddTaskRunsInline();
+    RejectsWhenStopped();
+    StopRacesWithProducers();
+    return TestResult();
+}